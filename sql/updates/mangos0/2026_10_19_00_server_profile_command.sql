@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `id` IN (812);
+INSERT INTO `command` (`id`, `command_text`, `security`, `help_text`) VALUES 
+(812, 'server profile', 3, 'Syntax: .server profile [#opcodes|reset]\r\nShow world tick, update phase and opcode handler timings collected by the tick profiler, listing the #opcodes (default 10) most expensive opcodes. Use reset to clear the statistics.');
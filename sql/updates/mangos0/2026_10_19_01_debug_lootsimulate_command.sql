@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `id` IN (813);
+INSERT INTO `command` (`id`, `command_text`, `security`, `help_text`) VALUES 
+(813, 'debug lootsimulate', 4, 'Syntax: .debug lootsimulate $store #lootid [#rolls]\r\nRoll loot template #lootid of $store (creature, gameobject, item, fishing, skinning, pickpocketing, disenchant, mail or reference) #rolls times (default 100000, at most 10000000) and show the roll speed and the drop rate of each non-quest item. Runs in the world thread.');
@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `id` IN (814);
+INSERT INTO `command` (`id`, `command_text`, `security`, `help_text`) VALUES 
+(814, 'server pools', 3, 'Syntax: .server pools\r\nShow allocation counts and live memory of the pooled object allocators (spells, auras, threat references, packets, database operations, events and items) and the memory taken by their slabs.');
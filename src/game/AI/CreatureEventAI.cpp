@@ -97,7 +97,6 @@ CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
     m_Phase(0),
     m_MeleeEnabled(true),
     m_currSpell(0),
-    m_HasOOCLoSEvent(false),
     m_InvinceabilityHpLevel(0),
     m_throwAIEventMask(0),
     m_throwAIEventStep(0)
@@ -140,11 +139,6 @@ CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
 #endif
                 {
                     m_CreatureEventAIList.push_back(CreatureEventAIHolder(*i));
-                    // Cache for fast use
-                    if (i->event_type == EVENT_T_OOC_LOS)
-                    {
-                        m_HasOOCLoSEvent = true;
-                    }
                 }
             }
         }
@@ -153,6 +147,8 @@ CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
     {
         sLog.outErrorEventAI("EventMap for Creature %u is empty but creature is using CreatureEventAI.", m_creature->GetEntry());
     }
+
+    BuildEventDispatchTables();
     // Handle Spawned Events, also calls Reset()
     JustRespawned();
 }
@@ -186,6 +182,45 @@ inline static bool IsTimerBasedEvent(EventAI_Type type)
     }
 }
 
+void CreatureEventAI::BuildEventDispatchTables()
+{
+    // counting sort by event type keeps the database order inside each type
+    memset(m_EventTypeStart, 0, sizeof(m_EventTypeStart));
+    for (CreatureEventAIList::const_iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    {
+        if (itr->Event.event_type < EVENT_T_END)
+        {
+            ++m_EventTypeStart[itr->Event.event_type + 1];
+        }
+    }
+
+    for (uint32 type = 0; type < EVENT_T_END; ++type)
+    {
+        m_EventTypeStart[type + 1] += m_EventTypeStart[type];
+    }
+
+    m_EventsByType.resize(m_EventTypeStart[EVENT_T_END]);
+
+    uint16 next[EVENT_T_END];
+    memcpy(next, m_EventTypeStart, sizeof(next));
+
+    for (uint32 i = 0; i < m_CreatureEventAIList.size(); ++i)
+    {
+        uint32 type = m_CreatureEventAIList[i].Event.event_type;
+        if (type >= EVENT_T_END)
+        {
+            continue;
+        }
+
+        m_EventsByType[next[type]++] = i;
+
+        if (IsTimerBasedEvent(EventAI_Type(type)))
+        {
+            m_TimerBasedEvents.push_back(i);
+        }
+    }
+}
+
 bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pActionInvoker, Creature* pAIEventSender /*=NULL*/)
 {
     if (!pHolder.Enabled || pHolder.Time)
@@ -550,6 +585,16 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             break;
     }
 
+    // repeat timers of callback driven events are counted down by UpdateAI
+    if (pHolder.Time && !IsTimerBasedEvent(event.event_type))
+    {
+        uint16 index = &pHolder - &m_CreatureEventAIList[0];
+        if (std::find(m_CoolingEvents.begin(), m_CoolingEvents.end(), index) == m_CoolingEvents.end())
+        {
+            m_CoolingEvents.push_back(index);
+        }
+    }
+
     // Disable non-repeatable events
     if (!(pHolder.Event.event_flags & EFLAG_REPEATABLE))
     {
@@ -1273,20 +1318,23 @@ void CreatureEventAI::JustRespawned()                       // NOTE that this is
 {
     Reset();
 
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    // Reset generic timer
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_TIMER_GENERIC); ++n)
     {
-        // Reset generic timer
-        if (i->Event.event_type == EVENT_T_TIMER_GENERIC)
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_TIMER_GENERIC, n);
+        if (holder.UpdateRepeatTimer(m_creature, holder.Event.timer.initialMin, holder.Event.timer.initialMax))
         {
-            if (i->UpdateRepeatTimer(m_creature, i->Event.timer.initialMin, i->Event.timer.initialMax))
-            {
-                i->Enabled = true;
-            }
+            holder.Enabled = true;
         }
-        // Handle Spawned Events
-        else if (SpawnedEventConditionsCheck(i->Event))
+    }
+
+    // Handle Spawned Events
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_SPAWNED); ++n)
+    {
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_SPAWNED, n);
+        if (SpawnedEventConditionsCheck(holder.Event))
         {
-            ProcessEvent(*i);
+            ProcessEvent(holder);
         }
     }
 }
@@ -1298,38 +1346,23 @@ void CreatureEventAI::Reset()
     m_EventDiff = 0;
     m_throwAIEventStep = 0;
 
-    // Reset all events to enabled
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    // Reset all out of combat timers
+    // TODO: verify if other events previously disabled (ex. aggro yell) should be enabled here instead of in void Aggro()
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_TIMER_OOC); ++n)
     {
-        CreatureEventAI_Event const& event = i->Event;
-        switch (event.event_type)
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_TIMER_OOC, n);
+        if (holder.UpdateRepeatTimer(m_creature, holder.Event.timer.initialMin, holder.Event.timer.initialMax))
         {
-                // Reset all out of combat timers
-            case EVENT_T_TIMER_OOC:
-            {
-                if (i->UpdateRepeatTimer(m_creature, event.timer.initialMin, event.timer.initialMax))
-                {
-                    i->Enabled = true;
-                }
-                break;
-            }
-            default:
-            // TODO: enable below code line / verify this is correct to enable events previously disabled (ex. aggro yell), instead of enable this in void Aggro()
-            //i->Enabled = true;
-            //i->Time = 0;
-            break;
+            holder.Enabled = true;
         }
     }
 }
 
 void CreatureEventAI::JustReachedHome()
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_REACHED_HOME); ++n)
     {
-        if (i->Event.event_type == EVENT_T_REACHED_HOME)
-        {
-            ProcessEvent(*i);
-        }
+        ProcessEvent(GetEvent(EVENT_T_REACHED_HOME, n));
     }
 
     Reset();
@@ -1352,12 +1385,9 @@ void CreatureEventAI::EnterEvadeMode()
     SetSpellsList(m_creature->GetCreatureInfo()->SpellListId);
 
     // Handle Evade events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_EVADE); ++n)
     {
-        if (i->Event.event_type == EVENT_T_EVADE)
-        {
-            ProcessEvent(*i);
-        }
+        ProcessEvent(GetEvent(EVENT_T_EVADE, n));
     }
     m_creature->ResetPlayerDamageReq();
 }
@@ -1381,12 +1411,9 @@ void CreatureEventAI::JustDied(Unit* killer)
     }
 
     // Handle On Death events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_DEATH); ++n)
     {
-        if (i->Event.event_type == EVENT_T_DEATH)
-        {
-            ProcessEvent(*i, killer);
-        }
+        ProcessEvent(GetEvent(EVENT_T_DEATH, n), killer);
     }
 
     // reset phase after any death state events
@@ -1400,45 +1427,33 @@ void CreatureEventAI::KilledUnit(Unit* victim)
         return;
     }
 
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_KILL); ++n)
     {
-        if (i->Event.event_type == EVENT_T_KILL)
-        {
-            ProcessEvent(*i, victim);
-        }
+        ProcessEvent(GetEvent(EVENT_T_KILL, n), victim);
     }
 }
 
 void CreatureEventAI::JustSummoned(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_SUMMONED_UNIT); ++n)
     {
-        if (i->Event.event_type == EVENT_T_SUMMONED_UNIT)
-        {
-            ProcessEvent(*i, pUnit);
-        }
+        ProcessEvent(GetEvent(EVENT_T_SUMMONED_UNIT, n), pUnit);
     }
 }
 
 void CreatureEventAI::SummonedCreatureJustDied(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_SUMMONED_JUST_DIED); ++n)
     {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DIED)
-        {
-            ProcessEvent(*i, pUnit);
-        }
+        ProcessEvent(GetEvent(EVENT_T_SUMMONED_JUST_DIED, n), pUnit);
     }
 }
 
 void CreatureEventAI::SummonedCreatureDespawn(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_SUMMONED_JUST_DESPAWN); ++n)
     {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
-        {
-            ProcessEvent(*i, pUnit);
-        }
+        ProcessEvent(GetEvent(EVENT_T_SUMMONED_JUST_DESPAWN, n), pUnit);
     }
 }
 
@@ -1446,18 +1461,21 @@ void CreatureEventAI::ReceiveAIEvent(AIEventType eventType, Creature* pSender, U
 {
     MANGOS_ASSERT(pSender);
 
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_RECEIVE_AI_EVENT); ++n)
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_AI_EVENT &&
-            itr->Event.receiveAIEvent.eventType == eventType && (!itr->Event.receiveAIEvent.senderEntry || itr->Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
-            {
-                ProcessEvent(*itr, pInvoker, pSender);
-            }
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_RECEIVE_AI_EVENT, n);
+        if (holder.Event.receiveAIEvent.eventType == eventType && (!holder.Event.receiveAIEvent.senderEntry || holder.Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
+        {
+            ProcessEvent(holder, pInvoker, pSender);
+        }
     }
 }
 
 void CreatureEventAI::EnterCombat(Unit* enemy)
 {
+    // all repeat timers except the in combat ones are reset below, events restarted by the aggro actions are added again
+    m_CoolingEvents.clear();
+
     // Check for on combat start events
     for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
     {
@@ -1512,24 +1530,23 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
     }
 
     // Check for OOC LOS Event
-    if (m_HasOOCLoSEvent && !m_creature->getVictim())
+    if (GetEventCount(EVENT_T_OOC_LOS) && !m_creature->getVictim())
     {
-        for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+        for (uint32 n = 0; n < GetEventCount(EVENT_T_OOC_LOS); ++n)
         {
-            if (itr->Event.event_type == EVENT_T_OOC_LOS)
-            {
-                // can trigger if closer than fMaxAllowedRange
-                float fMaxAllowedRange = (float)itr->Event.ooc_los.maxRange;
+            CreatureEventAIHolder& holder = GetEvent(EVENT_T_OOC_LOS, n);
+
+            // can trigger if closer than fMaxAllowedRange
+            float fMaxAllowedRange = (float)holder.Event.ooc_los.maxRange;
 
-                // if friendly event && who is not hostile OR hostile event && who is hostile
-                if ((itr->Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
-                    ((!itr->Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
+            // if friendly event && who is not hostile OR hostile event && who is hostile
+            if ((holder.Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
+                ((!holder.Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
+            {
+                // if range is ok and we are actually in LOS
+                if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
                 {
-                    // if range is ok and we are actually in LOS
-                    if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
-                    {
-                        ProcessEvent(*itr, who);
-                    }
+                    ProcessEvent(holder, who);
                 }
             }
         }
@@ -1567,22 +1584,42 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
 
 void CreatureEventAI::SpellHit(Unit* pUnit, const SpellEntry* pSpell)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_SPELLHIT); ++n)
     {
-        if (i->Event.event_type == EVENT_T_SPELLHIT)
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_SPELLHIT, n);
+
+        // If spell id matches (or no spell id) & if spell school matches (or no spell school)
+        if (!holder.Event.spell_hit.spellId || pSpell->Id == holder.Event.spell_hit.spellId)
         {
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i->Event.spell_hit.spellId || pSpell->Id == i->Event.spell_hit.spellId)
+            if (GetSchoolMask(pSpell->School) & holder.Event.spell_hit.schoolMask)
             {
-                if (GetSchoolMask(pSpell->School) & i->Event.spell_hit.schoolMask)
-                {
-                    ProcessEvent(*i, pUnit);
-                }
+                ProcessEvent(holder, pUnit);
             }
         }
     }
 }
 
+void CreatureEventAI::DecrementEventTimer(CreatureEventAIHolder& holder)
+{
+    if (!holder.Time)
+    {
+        return;
+    }
+
+    if (holder.Time > m_EventDiff)
+    {
+        // Do not decrement timers if event cannot trigger in this phase
+        if (!(holder.Event.event_inverse_phase_mask & (1 << m_Phase)))
+        {
+            holder.Time -= m_EventDiff;
+        }
+    }
+    else
+    {
+        holder.Time = 0;
+    }
+}
+
 void CreatureEventAI::UpdateAI(const uint32 diff)
 {
     // Check if we are in combat (also updates calls threat update code)
@@ -1593,36 +1630,35 @@ void CreatureEventAI::UpdateAI(const uint32 diff)
     {
         m_EventDiff += diff;
 
-        // Check for time based events
-        for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        // Count down repeat timers of callback driven events, finished ones leave the list
+        for (uint32 n = 0; n < m_CoolingEvents.size();)
         {
-            // Decrement Timers
-            if (i->Time)
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[m_CoolingEvents[n]];
+            DecrementEventTimer(holder);
+
+            if (holder.Time)
             {
-                if (i->Time > m_EventDiff)
-                {
-                    // Do not decrement timers if event cannot trigger in this phase
-                    if (!(i->Event.event_inverse_phase_mask & (1 << m_Phase)))
-                    {
-                        i->Time -= m_EventDiff;
-                    }
-                }
-                else
-                {
-                    i->Time = 0;
-                }
+                ++n;
+                continue;
             }
 
+            m_CoolingEvents[n] = m_CoolingEvents.back();
+            m_CoolingEvents.pop_back();
+        }
+
+        // Check for time based events
+        for (uint32 n = 0; n < m_TimerBasedEvents.size(); ++n)
+        {
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[m_TimerBasedEvents[n]];
+            DecrementEventTimer(holder);
+
             // Skip processing of events that have time remaining or are disabled
-            if (!(i->Enabled) || i->Time)
+            if (!holder.Enabled || holder.Time)
             {
                 continue;
             }
 
-            if (IsTimerBasedEvent(i->Event.event_type))
-            {
-                ProcessEvent(*i);
-            }
+            ProcessEvent(holder);
         }
 
         m_EventDiff = 0;
@@ -1789,21 +1825,19 @@ void CreatureEventAI::DoFindFriendlyMissingBuff(std::list<Creature*>& _list, flo
 
 void CreatureEventAI::ReceiveEmote(Player* pPlayer, uint32 text_emote)
 {
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 n = 0; n < GetEventCount(EVENT_T_RECEIVE_EMOTE); ++n)
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_EMOTE)
+        CreatureEventAIHolder& holder = GetEvent(EVENT_T_RECEIVE_EMOTE, n);
+        if (holder.Event.receive_emote.emoteId != text_emote)
         {
-            if (itr->Event.receive_emote.emoteId != text_emote)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            PlayerCondition pcon(0, itr->Event.receive_emote.condition, itr->Event.receive_emote.conditionValue1, itr->Event.receive_emote.conditionValue2);
-            if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
-            {
-                DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
-                ProcessEvent(*itr, pPlayer);
-            }
+        PlayerCondition pcon(0, holder.Event.receive_emote.condition, holder.Event.receive_emote.conditionValue1, holder.Event.receive_emote.conditionValue2);
+        if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
+        {
+            DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
+            ProcessEvent(holder, pPlayer);
         }
     }
 }
@@ -699,9 +699,20 @@ class CreatureEventAI : public CreatureAI
         typedef std::vector<CreatureEventAIHolder> CreatureEventAIList;
         CreatureEventAIList m_CreatureEventAIList;          // Holder for events (stores enabled, time, and eventid)
 
+        // Dispatch tables built at construction, all store indexes into m_CreatureEventAIList in database order
+        typedef std::vector<uint16> CreatureEventAIIndexList;
+        CreatureEventAIIndexList m_EventsByType;            // grouped by event type, see m_EventTypeStart
+        uint16 m_EventTypeStart[EVENT_T_END + 1];           // events of type t are m_EventsByType[m_EventTypeStart[t] .. m_EventTypeStart[t + 1])
+        CreatureEventAIIndexList m_TimerBasedEvents;        // polled by UpdateAI
+        CreatureEventAIIndexList m_CoolingEvents;           // other events with a repeat timer running
+
+        void BuildEventDispatchTables();
+        void DecrementEventTimer(CreatureEventAIHolder& holder);
+        CreatureEventAIHolder& GetEvent(EventAI_Type type, uint32 n) { return m_CreatureEventAIList[m_EventsByType[m_EventTypeStart[type] + n]]; }
+        uint32 GetEventCount(EventAI_Type type) const { return m_EventTypeStart[type + 1] - m_EventTypeStart[type]; }
+
         uint8  m_Phase;                                     // Current phase, max 32 phases
         bool   m_MeleeEnabled;                              // If we allow melee auto attack
-        bool   m_HasOOCLoSEvent;                            // Cache if a OOC-LoS Event exists
         uint32 m_InvinceabilityHpLevel;                     // Minimal health level allowed at damage apply
         uint32 m_currSpell;                                 // track current spell from ACTION_T_CAST if any
 
@@ -28,6 +28,12 @@
 #include "SocialMgr.h"
 #include "Chat.h"
 
+time_t Channel::s_trafficMinute = 0;
+uint32 Channel::s_messages = 0;
+uint32 Channel::s_packets = 0;
+uint32 Channel::s_lastMessages = 0;
+uint32 Channel::s_lastPackets = 0;
+
 Channel::Channel(const std::string& name)
     : m_announce(true), m_moderate(false), m_name(name), m_flags(0), m_channelId(0)
 {
@@ -111,9 +117,7 @@ void Channel::Join(Player* player, const char* password)
 
     data.clear();
 
-    PlayerInfo& pinfo = m_players[guid];
-    pinfo.player = guid;
-    pinfo.flags = MEMBER_FLAG_NONE;
+    AddPlayer(player);
 
     MakeYouJoined(&data);
     SendToOne(&data, guid);
@@ -124,7 +128,7 @@ void Channel::Join(Player* player, const char* password)
     if (!IsConstant() && !m_ownerGuid)
     {
         SetOwner(guid, (m_players.size() > 1 ? true : false));
-        m_players[guid].SetModerator(true);
+        GetPlayerInfo(guid)->SetModerator(true);
     }
 }
 
@@ -153,9 +157,9 @@ void Channel::Leave(Player* player, bool send)
         data.clear();
     }
 
-    bool changeowner = m_players[guid].IsOwner();
+    bool changeowner = GetPlayerInfo(guid)->IsOwner();
 
-    m_players.erase(guid);
+    RemovePlayer(guid);
     if (m_announce && (player->GetSession()->GetSecurity() < SEC_GAMEMASTER || !sWorld.getConfig(CONFIG_BOOL_SILENTLY_GM_JOIN_TO_CHANNEL)))
     {
         WorldPacket data;
@@ -167,7 +171,7 @@ void Channel::Leave(Player* player, bool send)
 
     if (changeowner)
     {
-        ObjectGuid newowner = !m_players.empty() ? m_players.begin()->second.player : ObjectGuid();
+        ObjectGuid newowner = !m_players.empty() ? m_players.front().player : ObjectGuid();
         SetOwner(newowner);
     }
 }
@@ -184,7 +188,7 @@ void Channel::KickOrBan(Player* player, const char* targetName, bool ban)
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -234,7 +238,7 @@ void Channel::KickOrBan(Player* player, const char* targetName, bool ban)
     }
 
     SendToAll(&data);
-    m_players.erase(targetGuid);
+    RemovePlayer(targetGuid);
     target->LeftChannel(this);
 
     if (changeowner)
@@ -256,7 +260,7 @@ void Channel::UnBan(Player* player, const char* targetName)
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -302,7 +306,7 @@ void Channel::Password(Player* player, const char* password)
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -330,7 +334,7 @@ void Channel::SetMode(Player* player, const char* targetName, bool moderator, bo
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -438,7 +442,7 @@ void Channel::SetOwner(Player* player, const char* targetName)
     }
 
     // set channel owner
-    m_players[targetGuid].SetModerator(true);
+    GetPlayerInfo(targetGuid)->SetModerator(true);
     SetOwner(targetGuid);
 }
 
@@ -485,15 +489,15 @@ void Channel::List(Player* player)
     uint32 count  = 0;
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
     {
-        Player* plr = sObjectMgr.GetPlayer(i->first);
+        Player* plr = i->plr;
 
         // PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
         // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-        if (plr && (player->GetSession()->GetSecurity() > SEC_PLAYER || plr->GetSession()->GetSecurity() <= gmLevelInWhoList) &&
+        if (plr->IsInWorld() && (player->GetSession()->GetSecurity() > SEC_PLAYER || plr->GetSession()->GetSecurity() <= gmLevelInWhoList) &&
                 plr->IsVisibleGloballyFor(player))
         {
-            data << ObjectGuid(i->first);
-            data << uint8(i->second.flags);                 // flags seems to be changed...
+            data << ObjectGuid(i->player);
+            data << uint8(i->flags);                        // flags seems to be changed...
             ++count;
         }
     }
@@ -515,7 +519,7 @@ void Channel::Announce(Player* player)
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -550,7 +554,7 @@ void Channel::Moderate(Player* player)
         return;
     }
 
-    if (!m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (!GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -608,7 +612,7 @@ void Channel::Say(Player* player, const char* text, uint32 lang)
         SendToOne(&data, guid);
         return;
     }
-    else if (m_players[guid].IsMuted() ||
+    else if (GetPlayerInfo(guid)->IsMuted() ||
              (GetChannelId() == CHANNEL_ID_LOCAL_DEFENSE && !speakInLocalDef) ||
              (GetChannelId() == CHANNEL_ID_WORLD_DEFENSE && !speakInWorldDef))
     {
@@ -618,7 +622,7 @@ void Channel::Say(Player* player, const char* text, uint32 lang)
         return;
     }
 
-    if (m_moderate && !m_players[guid].IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
+    if (m_moderate && !GetPlayerInfo(guid)->IsModerator() && player->GetSession()->GetSecurity() < SEC_GAMEMASTER)
     {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -633,7 +637,7 @@ void Channel::Say(Player* player, const char* text, uint32 lang)
     }
     WorldPacket data;
     ChatHandler::BuildChatPacket(data, CHAT_MSG_CHANNEL, text, Language(lang), player->GetChatTag(), guid, player->GetName(), ObjectGuid(), "", m_name.c_str(), player->GetHonorRankInfo().rank);
-    SendToAll(&data, !m_players[guid].IsModerator() ? guid : ObjectGuid());
+    SendToAll(&data, !GetPlayerInfo(guid)->IsModerator() ? guid : ObjectGuid());
 }
 
 void Channel::Invite(Player* player, const char* targetName)
@@ -699,11 +703,9 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 {
     if (m_ownerGuid)
     {
-        // [] will re-add player after it possible removed
-        PlayerList::iterator p_itr = m_players.find(m_ownerGuid);
-        if (p_itr != m_players.end())
+        if (PlayerInfo* pinfo = GetPlayerInfo(m_ownerGuid))
         {
-            p_itr->second.SetOwner(false);
+            pinfo->SetOwner(false);
         }
     }
 
@@ -712,7 +714,10 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     if (m_ownerGuid)
     {
         uint8 oldFlag = GetPlayerFlags(m_ownerGuid);
-        m_players[m_ownerGuid].SetOwner(true);
+        if (PlayerInfo* pinfo = GetPlayerInfo(m_ownerGuid))
+        {
+            pinfo->SetOwner(true);
+        }
 
         WorldPacket data;
         MakeModeChange(&data, m_ownerGuid, oldFlag);
@@ -728,16 +733,92 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    // the packet is built once, members carry their Player so no lookup by guid is needed
+    uint32 packets = 0;
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
     {
-        if (Player* plr = sObjectMgr.GetPlayer(i->first))
+        Player* plr = i->plr;
+        if (!plr->IsInWorld())
+        {
+            continue;
+        }
+
+        if (!guid || !plr->GetSocial()->HasIgnore(guid))
         {
-            if (!guid || !plr->GetSocial()->HasIgnore(guid))
-            {
-                plr->GetSession()->SendPacket(data);
-            }
+            plr->GetSession()->SendPacket(data);
+            ++packets;
         }
     }
+
+    CountTraffic(packets);
+}
+
+void Channel::AddPlayer(Player* player)
+{
+    PlayerInfo pinfo;
+    pinfo.player = player->GetObjectGuid();
+    pinfo.plr = player;
+    pinfo.flags = MEMBER_FLAG_NONE;
+
+    m_playerIndex[pinfo.player] = m_players.size();
+    m_players.push_back(pinfo);
+}
+
+void Channel::RemovePlayer(ObjectGuid guid)
+{
+    PlayerIndexMap::iterator p_itr = m_playerIndex.find(guid);
+    if (p_itr == m_playerIndex.end())
+    {
+        return;
+    }
+
+    uint32 index = p_itr->second;
+    m_playerIndex.erase(p_itr);
+
+    if (index + 1 != m_players.size())
+    {
+        m_players[index] = m_players.back();
+        m_playerIndex[m_players[index].player] = index;
+    }
+
+    m_players.pop_back();
+}
+
+void Channel::CountTraffic(uint32 packets)
+{
+    time_t minute = time(NULL) / MINUTE;
+    if (minute != s_trafficMinute)
+    {
+        bool previous = minute == s_trafficMinute + 1;
+        s_lastMessages = previous ? s_messages : 0;
+        s_lastPackets = previous ? s_packets : 0;
+        s_messages = 0;
+        s_packets = 0;
+        s_trafficMinute = minute;
+    }
+
+    ++s_messages;
+    s_packets += packets;
+}
+
+void Channel::GetTrafficStatistic(uint32& messages, uint32& packets)
+{
+    time_t minute = time(NULL) / MINUTE;
+    if (minute == s_trafficMinute)
+    {
+        messages = s_lastMessages;
+        packets = s_lastPackets;
+    }
+    else if (minute == s_trafficMinute + 1)
+    {
+        messages = s_messages;
+        packets = s_packets;
+    }
+    else
+    {
+        messages = 0;
+        packets = 0;
+    }
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
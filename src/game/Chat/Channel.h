@@ -135,6 +135,7 @@ class Channel
         struct PlayerInfo
         {
             ObjectGuid player;
+            Player* plr;                                    // members leave all channels before the Player is deleted
             uint8 flags;
 
             bool HasFlag(uint8 flag) { return flags & flag; }
@@ -234,6 +235,9 @@ class Channel
         * See also \ref MakeNotMember for non-static version.
         */
         static void MakeNotOnPacket(WorldPacket* data, const std::string &name);
+
+        /// Channel broadcasts and the packets they caused during the last full minute
+        static void GetTrafficStatistic(uint32& messages, uint32& packets);
     private:
         // initial packet data (notify type and channel name)
         void MakeNotifyPacket(WorldPacket* data, uint8 notify_type);
@@ -274,26 +278,37 @@ class Channel
         void SendToAll(WorldPacket* data, ObjectGuid guid = ObjectGuid());
         void SendToOne(WorldPacket* data, ObjectGuid who);
 
-        bool IsOn(ObjectGuid who) const { return m_players.find(who) != m_players.end(); }
+        static void CountTraffic(uint32 packets);
+
+        bool IsOn(ObjectGuid who) const { return m_playerIndex.find(who) != m_playerIndex.end(); }
         bool IsBanned(ObjectGuid guid) const { return m_banned.find(guid) != m_banned.end(); }
 
+        PlayerInfo* GetPlayerInfo(ObjectGuid guid)
+        {
+            PlayerIndexMap::const_iterator p_itr = m_playerIndex.find(guid);
+            return p_itr != m_playerIndex.end() ? &m_players[p_itr->second] : NULL;
+        }
+
+        void AddPlayer(Player* player);
+        void RemovePlayer(ObjectGuid guid);
+
         uint8 GetPlayerFlags(ObjectGuid guid) const
         {
-            PlayerList::const_iterator p_itr = m_players.find(guid);
-            if (p_itr == m_players.end())
+            PlayerIndexMap::const_iterator p_itr = m_playerIndex.find(guid);
+            if (p_itr == m_playerIndex.end())
             {
                 return 0;
             }
 
-            return p_itr->second.flags;
+            return m_players[p_itr->second].flags;
         }
 
         void SetModerator(ObjectGuid guid, bool set)
         {
-            if (m_players[guid].IsModerator() != set)
+            if (GetPlayerInfo(guid)->IsModerator() != set)
             {
                 uint8 oldFlag = GetPlayerFlags(guid);
-                m_players[guid].SetModerator(set);
+                GetPlayerInfo(guid)->SetModerator(set);
 
                 WorldPacket data;
                 MakeModeChange(&data, guid, oldFlag);
@@ -303,10 +318,10 @@ class Channel
 
         void SetMute(ObjectGuid guid, bool set)
         {
-            if (m_players[guid].IsMuted() != set)
+            if (GetPlayerInfo(guid)->IsMuted() != set)
             {
                 uint8 oldFlag = GetPlayerFlags(guid);
-                m_players[guid].SetMuted(set);
+                GetPlayerInfo(guid)->SetMuted(set);
 
                 WorldPacket data;
                 MakeModeChange(&data, guid, oldFlag);
@@ -323,8 +338,15 @@ class Channel
         uint32      m_channelId;
         ObjectGuid  m_ownerGuid;
 
-        typedef     std::map<ObjectGuid, PlayerInfo> PlayerList;
+        // members are kept dense for broadcasts, removal moves the last member into the gap
+        typedef     std::vector<PlayerInfo> PlayerList;
+        typedef     UNORDERED_MAP<ObjectGuid, uint32> PlayerIndexMap;
         PlayerList  m_players;
+        PlayerIndexMap m_playerIndex;
         GuidSet m_banned;
+
+        static time_t s_trafficMinute;                      // minute being counted, in minutes since epoch
+        static uint32 s_messages, s_packets;
+        static uint32 s_lastMessages, s_lastPackets;
 };
 #endif
@@ -229,6 +229,7 @@ ChatCommand* ChatHandler::getCommandTable()
         { "bg",             SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugBattlegroundCommand,        "", NULL },
         { "getitemstate",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemStateCommand,        "", NULL },
         { "lootrecipient",  SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugGetLootRecipientCommand,    "", NULL },
+        { "lootsimulate",   SEC_CONSOLE,        true,  &ChatHandler::HandleDebugLootSimulateCommand,        "", NULL },
         { "getitemvalue",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemValueCommand,        "", NULL },
         { "getvalue",       SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetValueCommand,            "", NULL },
         { "moditemvalue",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugModItemValueCommand,        "", NULL },
@@ -659,6 +660,8 @@ ChatCommand* ChatHandler::getCommandTable()
         { "log",            SEC_CONSOLE,        true,  NULL,                                           "", serverLogCommandTable },
         { "motd",           SEC_PLAYER,         true,  &ChatHandler::HandleServerMotdCommand,          "", NULL },
         { "plimit",         SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerPLimitCommand,        "", NULL },
+        { "pools",          SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerPoolsCommand,         "", NULL },
+        { "profile",        SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerProfileCommand,       "", NULL },
         { "resetallraid",   SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerResetAllRaidCommand,  "", NULL },
         { "restart",        SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverRestartCommandTable },
         { "shutdown",       SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverShutdownCommandTable },
@@ -826,6 +829,9 @@ ChatCommand* ChatHandler::getCommandTable()
         // check hardcoded part integrity
         CheckIntegrity(commandTable, NULL);
 
+        // names are hardcoded, only security and help come from the DB
+        sCommandMgr.BuildCommandIndex(commandTable);
+
         QueryResult* result = WorldDatabase.Query("SELECT `id`, `command_text`,`security`,`help_text` FROM `command`");
         if (result)
         {
@@ -839,6 +845,8 @@ ChatCommand* ChatHandler::getCommandTable()
             while (result->NextRow());
             delete result;
         }
+
+        sCommandMgr.UpdateCommandVisibility();
     }
 
     return commandTable;
@@ -1183,30 +1191,33 @@ ChatCommandSearchResult ChatHandler::FindCommand(ChatCommand* table, char const*
 
     while (*text == ' ') { ++text; }
 
-    // search first level command in table
-    for (uint32 i = 0; table[i].Name != NULL; ++i)
+    // search first level command in table, the index returns the same candidates a linear scan would accept
+    std::vector<ChatCommand*> matches;
+    if (ChatCommandIndex const* index = sCommandMgr.GetCommandIndex(table))
     {
-        if (exactlyName)
-        {
-            size_t len = strlen(table[i].Name);
-            if (strncmp(table[i].Name, cmd.c_str(), len + 1) != 0)
-            {
-                continue;
-            }
-        }
-        else
+        index->FindMatches(cmd.c_str(), exactlyName, matches);
+    }
+    else
+    {
+        for (uint32 i = 0; table[i].Name != NULL; ++i)
         {
-            if (!hasStringAbbr(table[i].Name, cmd.c_str()))
+            if (exactlyName ? strcmp(table[i].Name, cmd.c_str()) == 0 : hasStringAbbr(table[i].Name, cmd.c_str()))
             {
-                continue;
+                matches.push_back(&table[i]);
             }
         }
+    }
+
+    for (size_t m = 0; m < matches.size(); ++m)
+    {
+        ChatCommand* entry = matches[m];
+
         // select subcommand from child commands list
-        if (table[i].ChildCommands != NULL)
+        if (entry->ChildCommands != NULL)
         {
             char const* oldchildtext = text;
             ChatCommand* parentSubcommand = NULL;
-            ChatCommandSearchResult res = FindCommand(table[i].ChildCommands, text, command, &parentSubcommand, cmdNamePtr, allAvailable, exactlyName);
+            ChatCommandSearchResult res = FindCommand(entry->ChildCommands, text, command, &parentSubcommand, cmdNamePtr, allAvailable, exactlyName);
 
             switch (res)
             {
@@ -1215,7 +1226,7 @@ ChatCommandSearchResult ChatHandler::FindCommand(ChatCommand* table, char const*
                     // if subcommand success search not return parent command, then this parent command is owner of child commands
                     if (parentCommand)
                     {
-                        *parentCommand = parentSubcommand ? parentSubcommand : &table[i];
+                        *parentCommand = parentSubcommand ? parentSubcommand : entry;
                     }
 
                     // Name == "" is special case: restore original command text for next level "" (where parentSubcommand==NULL)
@@ -1229,14 +1240,14 @@ ChatCommandSearchResult ChatHandler::FindCommand(ChatCommand* table, char const*
                 case CHAT_COMMAND_UNKNOWN:
                 {
                     // command not found directly in child command list, return child command list owner
-                    command = &table[i];
+                    command = entry;
                     if (parentCommand)
                     {
                         *parentCommand = NULL;               // we don't known parent of table list at this point
                     }
 
                     text = oldchildtext;                    // restore text to stated just after parse found parent command
-                    return CHAT_COMMAND_UNKNOWN_SUBCOMMAND; // we not found subcommand for table[i]
+                    return CHAT_COMMAND_UNKNOWN_SUBCOMMAND; // we not found subcommand for entry
                 }
                 case CHAT_COMMAND_UNKNOWN_SUBCOMMAND:
                 default:
@@ -1244,7 +1255,7 @@ ChatCommandSearchResult ChatHandler::FindCommand(ChatCommand* table, char const*
                     // some deep subcommand not found, if this second level subcommand then parentCommand can be NULL, use known value for it
                     if (parentCommand)
                     {
-                        *parentCommand = parentSubcommand ? parentSubcommand : &table[i];
+                        *parentCommand = parentSubcommand ? parentSubcommand : entry;
                     }
                     return res;
                 }
@@ -1252,19 +1263,19 @@ ChatCommandSearchResult ChatHandler::FindCommand(ChatCommand* table, char const*
         }
 
         // must be available (not checked for subcommands case because parent command expected have most low access that all subcommands always
-        if (!allAvailable && !isAvailable(table[i]))
+        if (!allAvailable && !isAvailable(*entry))
         {
             continue;
         }
 
         // must be have handler is explicitly selected
-        if (!table[i].Handler)
+        if (!entry->Handler)
         {
             continue;
         }
 
         // command found directly in to table
-        command = &table[i];
+        command = entry;
 
         // unknown table owner at this point
         if (parentCommand)
@@ -1493,11 +1504,14 @@ bool ChatHandler::ParseCommands(const char* text)
 
 bool ChatHandler::ShowHelpForSubCommands(ChatCommand* table, char const* cmd)
 {
+    // console and in game access is precomputed per table, unusual account levels fall back to the virtual check
+    ChatCommandIndex const* index = GetAccessLevel() <= SEC_CONSOLE ? sCommandMgr.GetCommandIndex(table) : NULL;
+
     std::string list;
     for (uint32 i = 0; table[i].Name != NULL; ++i)
     {
         // must be available (ignore handler existence for show command with possible available subcommands
-        if (!isAvailable(table[i]))
+        if (index ? !index->IsVisible(i, GetAccessLevel(), !m_session) : !isAvailable(table[i]))
         {
             continue;
         }
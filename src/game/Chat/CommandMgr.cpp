@@ -25,13 +25,18 @@
 #include "CommandMgr.h"
 #include "ObjectMgr.h"
 #include "ProgressBar.h"
-
-class ChatCommand; // Forward declaration of
+#include "Chat.h"
 
 INSTANTIATE_SINGLETON_1(CommandMgr);
 
 CommandMgr::CommandMgr() {}
-CommandMgr::~CommandMgr() {}
+CommandMgr::~CommandMgr()
+{
+    for (ChatCommandIndexMap::iterator itr = m_CommandIndexes.begin(); itr != m_CommandIndexes.end(); ++itr)
+    {
+        delete itr->second;
+    }
+}
 
 // Perhaps migrate all this in ObjectMgr.cpp ?
 void CommandMgr::LoadCommandHelpLocale()
@@ -118,3 +123,157 @@ void CommandMgr::GetCommandHelpLocaleString(uint32 commandId, int32 loc_idx, std
         }
     }
 }
+
+ChatCommandIndex::ChatCommandIndex(ChatCommand* table) : m_table(table), m_nodes(1)
+{
+    for (uint32 i = 0; table[i].Name != NULL; ++i)
+    {
+        m_visibility.push_back(0);
+
+        if (!*table[i].Name)
+        {
+            m_emptyNamed.push_back(i);
+            continue;
+        }
+
+        uint32 node = 0;
+        for (char const* c = table[i].Name; *c; ++c)
+        {
+            char lower = char(tolower(*c));
+
+            uint32 next = 0;
+            for (size_t j = 0; j < m_nodes[node].children.size(); ++j)
+            {
+                if (m_nodes[node].children[j].first == lower)
+                {
+                    next = m_nodes[node].children[j].second;
+                    break;
+                }
+            }
+
+            if (!next)
+            {
+                next = m_nodes.size();
+                m_nodes[node].children.push_back(std::make_pair(lower, next));
+                m_nodes.push_back(Node());
+            }
+
+            node = next;
+            m_nodes[node].commands.push_back(i);
+        }
+    }
+
+}
+
+void ChatCommandIndex::FindMatches(char const* name, bool exactlyName, std::vector<ChatCommand*>& matches) const
+{
+    matches.clear();
+
+    // same rules as ChatHandler::hasStringAbbr: "" input only matches "" commands
+    std::vector<uint32> const* prefixed = NULL;
+    if (*name)
+    {
+        uint32 node = 0;
+        for (char const* c = name; *c; ++c)
+        {
+            char lower = char(tolower(*c));
+
+            uint32 next = 0;
+            for (size_t j = 0; j < m_nodes[node].children.size(); ++j)
+            {
+                if (m_nodes[node].children[j].first == lower)
+                {
+                    next = m_nodes[node].children[j].second;
+                    break;
+                }
+            }
+
+            if (!next)
+            {
+                break;
+            }
+
+            node = next;
+            if (!*(c + 1))
+            {
+                prefixed = &m_nodes[node].commands;
+            }
+        }
+    }
+
+    // merge both ascending lists to keep the table order
+    size_t p = 0, e = 0;
+    size_t prefixedCount = prefixed ? prefixed->size() : 0;
+    while (p < prefixedCount || e < m_emptyNamed.size())
+    {
+        uint32 index;
+        if (e >= m_emptyNamed.size() || (p < prefixedCount && (*prefixed)[p] < m_emptyNamed[e]))
+        {
+            index = (*prefixed)[p++];
+        }
+        else
+        {
+            index = m_emptyNamed[e++];
+        }
+
+        if (exactlyName && strcmp(m_table[index].Name, name) != 0)
+        {
+            continue;
+        }
+
+        matches.push_back(&m_table[index]);
+    }
+}
+
+void ChatCommandIndex::UpdateVisibility()
+{
+    for (uint32 i = 0; m_table[i].Name != NULL; ++i)
+    {
+        uint32 mask = 0;
+        for (uint32 level = SEC_PLAYER; level <= SEC_CONSOLE; ++level)
+        {
+            if (level >= m_table[i].SecurityLevel)
+            {
+                mask |= VisibilityBit(AccountTypes(level), false);
+                if (m_table[i].AllowConsole)
+                {
+                    mask |= VisibilityBit(AccountTypes(level), true);
+                }
+            }
+        }
+
+        m_visibility[i] = mask;
+    }
+}
+
+void CommandMgr::BuildCommandIndex(ChatCommand* table)
+{
+    if (m_CommandIndexes.find(table) != m_CommandIndexes.end())
+    {
+        return;
+    }
+
+    m_CommandIndexes[table] = new ChatCommandIndex(table);
+
+    for (uint32 i = 0; table[i].Name != NULL; ++i)
+    {
+        if (table[i].ChildCommands)
+        {
+            BuildCommandIndex(table[i].ChildCommands);
+        }
+    }
+}
+
+void CommandMgr::UpdateCommandVisibility()
+{
+    for (ChatCommandIndexMap::iterator itr = m_CommandIndexes.begin(); itr != m_CommandIndexes.end(); ++itr)
+    {
+        itr->second->UpdateVisibility();
+    }
+}
+
+ChatCommandIndex const* CommandMgr::GetCommandIndex(ChatCommand const* table) const
+{
+    ChatCommandIndexMap::const_iterator itr = m_CommandIndexes.find(table);
+    return itr != m_CommandIndexes.end() ? itr->second : NULL;
+}
@@ -28,6 +28,41 @@ struct CommandHelpLocale
 
 typedef UNORDERED_MAP<uint32, CommandHelpLocale> CommandHelpLocaleMap;
 
+class ChatCommand;
+
+// Case insensitive prefix trie over the names of one command table level
+class ChatCommandIndex
+{
+    public:
+        explicit ChatCommandIndex(ChatCommand* table);
+
+        // Commands matching the typed name (abbreviation or exact), in table order like a linear scan
+        void FindMatches(char const* name, bool exactlyName, std::vector<ChatCommand*>& matches) const;
+
+        // Access level and console flag of every command, precomputed for help listings
+        void UpdateVisibility();
+        bool IsVisible(uint32 index, AccountTypes level, bool console) const
+        {
+            return (m_visibility[index] & VisibilityBit(level, console)) != 0;
+        }
+
+    private:
+        static uint32 VisibilityBit(AccountTypes level, bool console) { return 1 << (uint32(level) * 2 + (console ? 1 : 0)); }
+
+        struct Node
+        {
+            std::vector<std::pair<char, uint32> > children;   // lower case character, node index
+            std::vector<uint32> commands;                     // table indexes of names with this prefix, ascending
+        };
+
+        ChatCommand* m_table;
+        std::vector<Node> m_nodes;                          // m_nodes[0] is the root
+        std::vector<uint32> m_emptyNamed;                   // "" commands match any input
+        std::vector<uint32> m_visibility;
+};
+
+typedef UNORDERED_MAP<ChatCommand const*, ChatCommandIndex*> ChatCommandIndexMap;
+
 
 class CommandMgr
 {
@@ -38,9 +73,15 @@ class CommandMgr
         void LoadCommandHelpLocale();
         void GetCommandHelpLocaleString(uint32 entry, int32 loc_idx, std::string* namePtr) const;
 
+        // Command name lookup, tables are static so the index is built once
+        void BuildCommandIndex(ChatCommand* table);
+        void UpdateCommandVisibility();
+        ChatCommandIndex const* GetCommandIndex(ChatCommand const* table) const;
+
     private:
         CommandHelpLocale const* GetCommandLocale(uint32 commandId) const;
         CommandHelpLocaleMap m_CommandHelpLocaleMap;
+        ChatCommandIndexMap m_CommandIndexes;
 };
 
 
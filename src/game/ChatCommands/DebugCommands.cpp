@@ -37,6 +37,7 @@
 #include "ObjectMgr.h"
 #include "ObjectGuid.h"
 #include "SpellMgr.h"
+#include "LootMgr.h"
 
 /**********************************************************************
      CommandTable : debugCommandTable
@@ -885,6 +886,82 @@ bool ChatHandler::HandleDebugSpellCheckCommand(char* /*args*/)
     return true;
 }
 
+// roll a loot template many times and show the item drop rates and the roll throughput
+bool ChatHandler::HandleDebugLootSimulateCommand(char* args)
+{
+    char* storeName = ExtractLiteralArg(&args);
+    if (!storeName)
+    {
+        return false;
+    }
+
+    uint32 lootId;
+    if (!ExtractUInt32(&args, lootId))
+    {
+        return false;
+    }
+
+    uint32 rolls;
+    if (!ExtractOptUInt32(&args, rolls, 100000))
+    {
+        return false;
+    }
+
+    // runs in the world thread, keep it bounded
+    rolls = std::max(1u, std::min(rolls, 10000000u));
+
+    LootStore const* stores[] =
+    {
+        &LootTemplates_Creature, &LootTemplates_Disenchant, &LootTemplates_Fishing, &LootTemplates_Gameobject, &LootTemplates_Item,
+        &LootTemplates_Mail, &LootTemplates_Pickpocketing, &LootTemplates_Reference, &LootTemplates_Skinning
+    };
+
+    LootStore const* store = NULL;
+    for (uint32 i = 0; i < countof(stores); ++i)
+    {
+        if (strncmp(stores[i]->GetName(), storeName, strlen(storeName)) == 0)
+        {
+            store = stores[i];
+            break;
+        }
+    }
+
+    LootTemplate const* tab = store ? store->GetLootFor(lootId) : NULL;
+    if (!tab)
+    {
+        PSendSysMessage("No loot template %u in %s_loot_template", lootId, storeName); // ToDo: move to language string
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    std::map<uint32, uint32> drops;                         // item id, times dropped
+    uint32 itemCount = 0;
+
+    uint32 startTime = getMSTime();
+    for (uint32 i = 0; i < rolls; ++i)
+    {
+        Loot loot(NULL);
+        tab->Process(loot, *store, store->IsRatesAllowed());
+
+        for (LootItemList::const_iterator itr = loot.items.begin(); itr != loot.items.end(); ++itr)
+        {
+            ++drops[itr->itemid];
+        }
+        itemCount += loot.items.size();
+    }
+    uint32 timeMS = std::max(1u, GetMSTimeDiffToNow(startTime));
+
+    PSendSysMessage("%u rolls of %s %u in %u ms (%u rolls/s), %.3f items per roll, quest drops not counted", rolls, store->GetName(), lootId, timeMS,
+                    uint32(uint64(rolls) * IN_MILLISECONDS / timeMS), float(itemCount) / rolls); // ToDo: move to language string
+
+    for (std::map<uint32, uint32>::const_iterator itr = drops.begin(); itr != drops.end(); ++itr)
+    {
+        PSendSysMessage("  item %u: %.4f%%", itr->first, 100.0f * itr->second / rolls);
+    }
+
+    return true;
+}
+
 // show animation
 bool ChatHandler::HandleDebugAnimCommand(char* args)
 {
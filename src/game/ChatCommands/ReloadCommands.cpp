@@ -32,6 +32,7 @@
 #include "BattleGroundMgr.h"
 #include "ItemEnchantmentMgr.h"
 #include "CommandMgr.h"
+#include "QueryResponseCache.h"
 
  /**********************************************************************
      CommandTable : commandTable
@@ -197,6 +198,7 @@ bool ChatHandler::HandleReloadConfigCommand(char* /*args*/)
     sLog.outString("Re-Loading config settings...");
     sWorld.LoadConfigSettings(true);
     sMapMgr.InitializeVisibilityDistanceInfo();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_ITEM);   // mount level requirements
     SendGlobalSysMessage("World config settings reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -307,6 +309,7 @@ bool ChatHandler::HandleReloadQuestTemplateCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Quest Templates...");
     sObjectMgr.LoadQuests();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_QUEST);
     SendGlobalSysMessage("DB table `quest_template` (quest definitions) reloaded.", SEC_MODERATOR);
 
     /// dependent also from `gameobject` but this table not reloaded anyway
@@ -410,6 +413,7 @@ bool ChatHandler::HandleReloadNpcGossipCommand(char* args)
     sObjectMgr.LoadGossipMenus();
     sLog.outString("Re-Loading 'gossip_text' Table!");
     sObjectMgr.LoadGossipText();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_NPC_TEXT);
     SendGlobalSysMessage("DB tables `Gossip_menu` and `gossip_text` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -418,6 +422,7 @@ bool ChatHandler::HandleReloadNpcTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading `npc_text` Table!");
     sObjectMgr.LoadGossipText();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_NPC_TEXT);
     SendGlobalSysMessage("DB table `npc_text` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -601,6 +606,7 @@ bool ChatHandler::HandleReloadPageTextsCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Page Texts...");
     sObjectMgr.LoadPageTexts();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_PAGE_TEXT);
     SendGlobalSysMessage("DB table `page_texts` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -874,6 +880,7 @@ bool ChatHandler::HandleReloadLocalesCreatureCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Creature ...");
     sObjectMgr.LoadCreatureLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_CREATURE);
     SendGlobalSysMessage("DB table `locales_creature` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -882,6 +889,7 @@ bool ChatHandler::HandleReloadLocalesGameobjectCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Gameobject ... ");
     sObjectMgr.LoadGameObjectLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_GAMEOBJECT);
     SendGlobalSysMessage("DB table `locales_gameobject` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -898,6 +906,8 @@ bool ChatHandler::HandleReloadLocalesItemCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Item ... ");
     sObjectMgr.LoadItemLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_ITEM);
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_ITEM_NAME);
     SendGlobalSysMessage("DB table `locales_item` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -906,6 +916,7 @@ bool ChatHandler::HandleReloadLocalesNpcTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales NPC Text ... ");
     sObjectMgr.LoadGossipTextLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_NPC_TEXT);
     SendGlobalSysMessage("DB table `locales_npc_text` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -922,6 +933,7 @@ bool ChatHandler::HandleReloadLocalesPageTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Page Text ... ");
     sObjectMgr.LoadPageTextLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_PAGE_TEXT);
     SendGlobalSysMessage("DB table `locales_page_text` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -938,6 +950,7 @@ bool ChatHandler::HandleReloadLocalesQuestCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Quest ... ");
     sObjectMgr.LoadQuestLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_QUEST);
     SendGlobalSysMessage("DB table `locales_quest` reloaded.", SEC_MODERATOR);
     return true;
 }
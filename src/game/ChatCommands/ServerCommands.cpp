@@ -29,6 +29,11 @@
 #include "GitRevision.h"
 #include "SystemConfig.h"
 #include "UpdateTime.h"
+#include "TickProfiler.h"
+#include "Utilities/ObjectPool.h"
+#include "MassMailMgr.h"
+#include "Channel.h"
+#include "MovementRelay.h"
 #include "revision_data.h"
 
  /**********************************************************************
@@ -74,6 +79,24 @@ bool ChatHandler::HandleServerInfoCommand(char* /*args*/)
     PSendSysMessage(LANG_UPTIME, str.c_str());
     PSendSysMessage("World Delay: %u", updateTime); // ToDo: move to language string
 
+    uint32 channelMessages, channelPackets;
+    Channel::GetTrafficStatistic(channelMessages, channelPackets);
+    PSendSysMessage("Channel messages last minute: %u (%u packets)", channelMessages, channelPackets); // ToDo: move to language string
+
+    if (sWorld.getConfig(CONFIG_BOOL_MOVEMENT_RELAY))
+    {
+        uint64 relaySent, relayCoalesced, relayThinned;
+        MovementRelay::GetStatistic(relaySent, relayCoalesced, relayThinned);
+        PSendSysMessage("Movement relay: " UI64FMTD " heartbeats sent, " UI64FMTD " coalesced, " UI64FMTD " not sent to far observers", relaySent, relayCoalesced, relayThinned); // ToDo: move to language string
+    }
+
+    uint32 massMailTasks, massMails, massMailTime;
+    sMassMailMgr.GetStatistic(massMailTasks, massMails, massMailTime);
+    if (massMailTasks)
+    {
+        PSendSysMessage("Mass mail: %u tasks, %u mails pending, about %u sec left", massMailTasks, massMails, massMailTime); // ToDo: move to language string
+    }
+
     return true;
 }
 
@@ -84,6 +107,58 @@ bool ChatHandler::HandleServerMotdCommand(char* /*args*/)
     return true;
 }
 
+/// Display the allocation statistics of the object pools
+bool ChatHandler::HandleServerPoolsCommand(char* /*args*/)
+{
+    for (MaNGOS::ObjectPool const* pool = MaNGOS::ObjectPool::GetFirst(); pool; pool = pool->GetNext())
+    {
+        uint64 allocations = pool->GetAllocations();
+        uint64 deallocations = pool->GetDeallocations();
+        uint64 live = allocations > deallocations ? allocations - deallocations : 0;
+
+        PSendSysMessage("%s: " UI64FMTD " allocated, " UI64FMTD " live (" UI64FMTD " KB), " UI64FMTD " oversized", // ToDo: move to language string
+                        pool->GetName(), allocations, live, pool->GetLiveBytes() / 1024, pool->GetOversized());
+    }
+
+    uint64 slabs, bytes;
+    MaNGOS::ObjectPool::GetSlabStatistic(slabs, bytes);
+    PSendSysMessage("Slabs: " UI64FMTD " (" UI64FMTD " KB)", slabs, bytes / 1024); // ToDo: move to language string
+    return true;
+}
+
+/// Display the tick profiler histograms and most expensive opcodes, or reset them
+bool ChatHandler::HandleServerProfileCommand(char* args)
+{
+    if (!sTickProfiler.IsEnabled())
+    {
+        SendSysMessage("Tick profiler is disabled (TickProfiler.Enable)."); // ToDo: move to language string
+        return true;
+    }
+
+    if (ExtractLiteralArg(&args, "reset"))
+    {
+        sTickProfiler.Reset();
+        SendSysMessage("Tick profiler statistics reset."); // ToDo: move to language string
+        return true;
+    }
+
+    uint32 topOpcodes;
+    if (!ExtractOptUInt32(&args, topOpcodes, 10))
+    {
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    sTickProfiler.BuildReport(lines, topOpcodes);
+
+    for (std::vector<std::string>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr)
+    {
+        PSendSysMessage("%s", itr->c_str());
+    }
+
+    return true;
+}
+
 bool ChatHandler::HandleServerShutDownCancelCommand(char* /*args*/)
 {
     sWorld.ShutdownCancel();
@@ -149,7 +149,7 @@ void Camera::UpdateVisibilityOf(WorldObject* target)
     m_owner.UpdateVisibilityOf(m_source, target);
 }
 
-void Camera::UpdateVisibilityOf(WorldObject* target, UpdateData& data, std::set<WorldObject*>& vis)
+void Camera::UpdateVisibilityOf(WorldObject* target, UpdateData& data, VisibleObjectSet& vis)
 {
     m_owner.UpdateVisibilityOf(m_source, target, data, vis);
 }
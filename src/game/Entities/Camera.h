@@ -27,6 +27,7 @@
 
 #include "Common.h"
 #include "GridDefines.h"
+#include "Utilities/TickArena.h"
 
 class ViewPoint;
 class WorldObject;
@@ -34,6 +35,9 @@ class UpdateData;
 class WorldPacket;
 class Player;
 
+/// Objects that became visible to a camera during one visibility update, kept in the map tick arena
+typedef std::set<WorldObject*, std::less<WorldObject*>, MaNGOS::TickAllocator<WorldObject*> > VisibleObjectSet;
+
 /// Camera - object-receiver. Receives broadcast packets from nearby worldobjects, object visibility changes and sends them to client
 class Camera
 {
@@ -54,7 +58,7 @@ class Camera
         // set view to camera's owner
         void ResetView(bool update_far_sight_field = true);
 
-        void UpdateVisibilityOf(WorldObject* obj, UpdateData& d, std::set<WorldObject*>& vis);
+        void UpdateVisibilityOf(WorldObject* obj, UpdateData& d, VisibleObjectSet& vis);
         void UpdateVisibilityOf(WorldObject* obj);
 
         void ReceivePacket(WorldPacket* data);
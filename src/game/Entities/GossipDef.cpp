@@ -29,6 +29,7 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include "Formulas.h"
+#include "QueryResponseCache.h"
 
 // Constructor for GossipMenu, initializes the session and reserves space for menu items
 GossipMenu::GossipMenu(WorldSession* session) : m_session(session)
@@ -595,6 +596,17 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* pQuest, ObjectGuid guid
 // Sends the quest query response to the player
 void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest) const
 {
+    // Get the locale index for the session
+    int loc_idx = GetMenuSession()->GetSessionDbLocaleIndex();
+
+    // Send the already built response if any
+    uint32 generation;
+    if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_QUEST, pQuest->GetQuestId(), loc_idx, generation))
+    {
+        GetMenuSession()->SendPacket(response.get());
+        return;
+    }
+
     // Retrieve the quest title, details, objectives, and end text
     std::string Title = pQuest->GetTitle();
     std::string Details = pQuest->GetDetails();
@@ -607,8 +619,6 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest) const
         ObjectiveText[i] = pQuest->ObjectiveText[i];
     }
 
-    // Get the locale index for the session
-    int loc_idx = GetMenuSession()->GetSessionDbLocaleIndex();
     if (loc_idx >= 0)
     {
         // Retrieve localized quest strings if available
@@ -737,7 +747,8 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest) const
         data << ObjectiveText[iI];
     }
 
-    // Send the packet to the player
+    // Keep it for the next queries and send the packet to the player
+    sQueryResponseCache.Store(QUERY_RESPONSE_QUEST, pQuest->GetQuestId(), loc_idx, data, generation);
     GetMenuSession()->SendPacket(&data);
 
     // Log the sent packet
@@ -913,12 +913,16 @@ WorldObject::WorldObject() :
 #endif /* ENABLE_ELUNA */
     m_currMap(NULL),
     m_mapId(0), m_InstanceId(0),
-    m_isActiveObject(false)
+    m_isActiveObject(false),
+    m_lastFarUpdateTime(0), m_hasFarChanges(false)
 {
 }
 
 WorldObject::~WorldObject()
 {
+    // objects deleted at grid unload are still stored in the cell
+    RemoveFromObjectIndex();
+
 #ifdef ENABLE_ELUNA
     delete elunaEvents;
     elunaEvents = nullptr;
@@ -956,6 +960,8 @@ void WorldObject::Relocate(float x, float y, float z, float orientation)
     {
         ((Unit*)this)->m_movementInfo.ChangePosition(x, y, z, orientation);
     }
+
+    UpdateObjectIndex();
 }
 
 void WorldObject::Relocate(float x, float y, float z)
@@ -968,6 +974,30 @@ void WorldObject::Relocate(float x, float y, float z)
     {
         ((Unit*)this)->m_movementInfo.ChangePosition(x, y, z, GetOrientation());
     }
+
+    UpdateObjectIndex();
+}
+
+void WorldObject::AddToObjectIndex(GridObjectIndex& index, uint32 flags)
+{
+    RemoveFromObjectIndex();
+    index.Insert(this, m_objectIndexRef, m_objectType, flags, m_position.x, m_position.y, GetObjectBoundingRadius());
+}
+
+void WorldObject::RemoveFromObjectIndex()
+{
+    if (m_objectIndexRef.index)
+    {
+        m_objectIndexRef.index->Remove(m_objectIndexRef);
+    }
+}
+
+void WorldObject::UpdateObjectIndex()
+{
+    if (m_objectIndexRef.index)
+    {
+        m_objectIndexRef.index->Relocate(m_objectIndexRef.slot, m_position.x, m_position.y, GetObjectBoundingRadius());
+    }
 }
 
 void WorldObject::SetOrientation(float orientation)
@@ -1999,7 +2029,9 @@ struct WorldObjectChangeAccumulator
 {
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
-    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d) : i_updateDatas(d), i_object(obj)
+    float i_nearDistSq;                                     // observers beyond are skipped, 0 for none
+    bool i_skippedFar;
+    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d, float nearDist) : i_updateDatas(d), i_object(obj), i_nearDistSq(nearDist * nearDist), i_skippedFar(false)
     {
         // send self fields changes in another way, otherwise
         // with new camera system when player's camera too far from player, camera wouldn't receive packets and changes from player
@@ -2016,6 +2048,18 @@ struct WorldObjectChangeAccumulator
             Player* owner = iter->getSource()->GetOwner();
             if (owner != &i_object && owner->HaveAtClient(&i_object))
             {
+                if (i_nearDistSq > 0.0f)
+                {
+                    WorldObject* body = iter->getSource()->GetBody();
+                    float dx = body->GetPositionX() - i_object.GetPositionX();
+                    float dy = body->GetPositionY() - i_object.GetPositionY();
+                    if (dx * dx + dy * dy > i_nearDistSq)
+                    {
+                        i_skippedFar = true;
+                        continue;
+                    }
+                }
+
                 i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
             }
         }
@@ -2026,12 +2070,61 @@ struct WorldObjectChangeAccumulator
 
 void WorldObject::BuildUpdateData(UpdateDataMapType& update_players)
 {
-    WorldObjectChangeAccumulator notifier(*this, update_players);
+    float nearDist = 0.0f;
+
+    // far observers get changes of units only once per Visibility.InterestUpdateInterval
+    if (isType(TYPEMASK_UNIT) && GetMap()->GetInterestDistance() > 0.0f)
+    {
+        uint32 now = GameTime::GetGameTimeMS();
+        if (IsFarUpdateDue(now))
+        {
+            // everybody gets fields held back, observer could come near since they changed
+            if (m_hasFarChanges)
+            {
+                for (uint16 index = 0; index < m_valuesCount; ++index)
+                {
+                    if (m_farChangedValues[index])
+                    {
+                        m_changedValues[index] = true;
+                        m_farChangedValues[index] = false;
+                    }
+                }
+                m_hasFarChanges = false;
+            }
+            m_lastFarUpdateTime = now;
+        }
+        else
+        {
+            nearDist = GetMap()->GetInterestDistance();
+        }
+    }
+
+    WorldObjectChangeAccumulator notifier(*this, update_players, nearDist);
     Cell::VisitWorldObjects(this, notifier, GetMap()->GetVisibilityDistance());
 
+    if (notifier.i_skippedFar)
+    {
+        m_farChangedValues.resize(m_valuesCount, false);
+        for (uint16 index = 0; index < m_valuesCount; ++index)
+        {
+            if (m_changedValues[index])
+            {
+                m_farChangedValues[index] = true;
+            }
+        }
+
+        m_hasFarChanges = true;
+        GetMap()->AddFarUpdateObject(this);
+    }
+
     ClearUpdateMask(false);
 }
 
+bool WorldObject::IsFarUpdateDue(uint32 now) const
+{
+    return getMSTimeDiff(m_lastFarUpdateTime, now) >= sWorld.getConfig(CONFIG_UINT32_INTEREST_UPDATE_INTERVAL);
+}
+
 bool WorldObject::PrintCoordinatesError(float x, float y, float z, char const* descr) const
 {
     sLog.outError("%s with invalid %s coordinates: mapid = %uu, x = %f, y = %f, z = %f", GetGuidStr().c_str(), descr, GetMapId(), x, y, z);
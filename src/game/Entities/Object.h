@@ -31,6 +31,7 @@
 #include "UpdateData.h"
 #include "ObjectGuid.h"
 #include "Camera.h"
+#include "GameSystem/GridObjectIndex.h"
 #include "GameTime.h"
 #ifdef ENABLE_ELUNA
 #include "LuaValue.h"
@@ -87,7 +88,8 @@ class LuaVal;
 #endif /* ENABLE_ELUNA */
 struct MangosStringLocale;
 
-typedef UNORDERED_MAP<Player*, UpdateData> UpdateDataMapType;
+// built and sent within one tick, kept in the map tick arena when built by a map update
+typedef UNORDERED_MAP<Player*, UpdateData, std::hash<Player*>, std::equal_to<Player*>, MaNGOS::TickAllocator<std::pair<Player* const, UpdateData> > > UpdateDataMapType;
 
 struct Position
 {
@@ -677,6 +679,15 @@ class WorldObject : public Object
         void RemoveFromClientUpdateList() override;
         void BuildUpdateData(UpdateDataMapType&) override;
 
+        // entry in the object index of the grid cell, maintained by Map while stored in the cell
+        void AddToObjectIndex(GridObjectIndex& index, uint32 flags);
+        void RemoveFromObjectIndex();
+        void UpdateObjectIndex();                           // at bounding radius change
+
+        // value changes held back from observers beyond map interest distance
+        bool HasFarUpdatePending() const { return m_hasFarChanges; }
+        bool IsFarUpdateDue(uint32 now) const;
+
         Creature* SummonCreature(uint32 id, float x, float y, float z, float ang, TempSpawnType spwtype, uint32 despwtime, bool asActiveObject = false, bool setRun = false);
         GameObject* SummonGameObject(uint32 id, float x, float y, float z, float angle, uint32 despwtime);
 
@@ -723,6 +734,12 @@ class WorldObject : public Object
         ViewPoint m_viewPoint;
         WorldUpdateCounter m_updateTracker;
         bool m_isActiveObject;
+
+        GridObjectIndexRef m_objectIndexRef;
+
+        std::vector<bool> m_farChangedValues;               // changed since last update sent to far observers
+        uint32 m_lastFarUpdateTime;
+        bool m_hasFarChanges;
 };
 
 // Helper functions to cast between different Object pointers. Useful when unsure that your object* is valid at all.
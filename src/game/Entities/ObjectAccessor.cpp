@@ -210,11 +210,13 @@ void ObjectAccessor::AddCorpsesToGrid(GridPair const& gridpair, GridType& grid,
               if (iter->second->GetInstanceId() == map->GetInstanceId())
               {
                   grid.AddWorldObject(iter->second);
+                  iter->second->AddToObjectIndex(grid.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
               }
           }
           else
           {
               grid.AddWorldObject(iter->second);
+              iter->second->AddToObjectIndex(grid.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
           }
       }
 }
@@ -81,6 +81,20 @@ uint32 ObjectGuidGenerator<high>::Generate()
     return m_nextGuid++;
 }
 
+template<HighGuid high>
+uint32 ObjectGuidGenerator<high>::GenerateRange(uint32 count)
+{
+    if (m_nextGuid >= ObjectGuid::GetMaxCounter(high) - 1 - count)
+    {
+        sLog.outError("%s guid overflow!! Can't continue, shutting down server. ", ObjectGuid::GetTypeName(high));
+        World::StopNow(ERROR_EXIT_CODE);
+    }
+
+    uint32 first = m_nextGuid;
+    m_nextGuid += count;
+    return first;
+}
+
 ByteBuffer& operator<< (ByteBuffer& buf, ObjectGuid const& guid)
 {
     buf << uint64(guid.GetRawValue());
@@ -106,6 +120,7 @@ ByteBuffer& operator>>(ByteBuffer& buf, PackedGuidReader const& guid)
 }
 
 template uint32 ObjectGuidGenerator<HIGHGUID_ITEM>::Generate();
+template uint32 ObjectGuidGenerator<HIGHGUID_ITEM>::GenerateRange(uint32);
 template uint32 ObjectGuidGenerator<HIGHGUID_PLAYER>::Generate();
 template uint32 ObjectGuidGenerator<HIGHGUID_GAMEOBJECT>::Generate();
 template uint32 ObjectGuidGenerator<HIGHGUID_TRANSPORT>::Generate();
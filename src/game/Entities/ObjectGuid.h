@@ -232,6 +232,7 @@ class ObjectGuidGenerator
     public:                                                 // modifiers
         void Set(uint32 val) { m_nextGuid = val; }
         uint32 Generate();
+        uint32 GenerateRange(uint32 count);                 // returns the first of count consecutive guids
 
     public:                                                 // accessors
         uint32 GetNextAfterMaxUsed() const { return m_nextGuid; }
@@ -157,8 +157,24 @@ T IdGenerator<T>::Generate()
     return m_nextGuid++;
 }
 
+template<typename T>
+T IdGenerator<T>::GenerateRange(T count)
+{
+    if (m_nextGuid >= std::numeric_limits<T>::max() - 1 - count)
+    {
+        sLog.outError("%s guid overflow!! Can't continue, shutting down server. ", m_name);
+        World::StopNow(ERROR_EXIT_CODE);
+    }
+
+    T first = m_nextGuid;
+    m_nextGuid += count;
+    return first;
+}
+
 template uint32 IdGenerator<uint32>::Generate();
 template uint64 IdGenerator<uint64>::Generate();
+template uint32 IdGenerator<uint32>::GenerateRange(uint32);
+template uint64 IdGenerator<uint64>::GenerateRange(uint64);
 
 // create the standing order
 bool operator < (const HonorStanding& lhs, const HonorStanding& rhs)
@@ -498,6 +498,7 @@ class IdGenerator
             m_nextGuid = val;
         }
         T Generate();
+        T GenerateRange(T count);                           // returns the first of count consecutive ids
 
     public:                                                 // accessors
         T GetNextAfterMaxUsed() const
@@ -849,6 +850,10 @@ class ObjectMgr
         {
             return m_ItemGuids.Generate();
         }
+        uint32 GenerateItemLowGuidRange(uint32 count)
+        {
+            return m_ItemGuids.GenerateRange(count);
+        }
         uint32 GenerateCorpseLowGuid()
         {
             return m_CorpseGuids.Generate();
@@ -870,6 +875,10 @@ class ObjectMgr
         {
             return m_MailIds.Generate();
         }
+        uint32 GenerateMailIDRange(uint32 count)
+        {
+            return m_MailIds.GenerateRange(count);
+        }
         uint32 GeneratePetNumber()
         {
             return m_PetNumbers.Generate();
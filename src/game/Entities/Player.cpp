@@ -2178,6 +2178,8 @@ void Player::AddToWorld()
         }
     }
 
+    m_session->SetPlayerInWorld(true);
+
     // Notifies player about his group status while adding him into the world
     // Restricted to players having a group in raid mode
     if (GetTransport() && GetGroup() && GetGroup()->isRaidGroup())
@@ -2189,6 +2191,8 @@ void Player::AddToWorld()
 
 void Player::RemoveFromWorld()
 {
+    m_session->SetPlayerInWorld(false);
+
     // cleanup
     if (IsInWorld())
     {
@@ -20942,7 +20946,7 @@ void Player::UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* targe
 }
 
 //4 params version (4p)
-void Player::UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* target, UpdateData& data, std::set<WorldObject*>& visibleNow)
+void Player::UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* target, UpdateData& data, VisibleObjectSet& visibleNow)
 {
     if (HaveAtClient(target))
     {
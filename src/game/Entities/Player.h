@@ -3397,7 +3397,7 @@ class Player : public Unit
 
         // Update the visibility of a target from a viewpoint
         void UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* target);
-        void UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* target, UpdateData& data, std::set<WorldObject*>& visibleNow);
+        void UpdateVisibilityOf(WorldObject const* viewPoint, WorldObject* target, UpdateData& data, VisibleObjectSet& visibleNow);
 
 
         // Handle detection of stealthed units
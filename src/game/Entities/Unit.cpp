@@ -3502,18 +3502,16 @@ void Unit::_UpdateSpells(uint32 time)
     }
 
     // remove expired auras
-    for (SpellAuraHolderMap::iterator iter = m_spellAuraHolders.begin(); iter != m_spellAuraHolders.end();)
+    // single pass: m_spellAuraHoldersUpdateIterator is kept valid by RemoveSpellAuraHolder even when
+    // the removal cascades into other holders, so iteration never has to restart from begin()
+    for (m_spellAuraHoldersUpdateIterator = m_spellAuraHolders.begin(); m_spellAuraHoldersUpdateIterator != m_spellAuraHolders.end();)
     {
-        SpellAuraHolder* holder = iter->second;
+        SpellAuraHolder* holder = m_spellAuraHoldersUpdateIterator->second;
+        ++m_spellAuraHoldersUpdateIterator;
 
         if (!(holder->IsPermanent() || holder->IsPassive()) && holder->GetAuraDuration() == 0)
         {
             RemoveSpellAuraHolder(holder, AURA_REMOVE_BY_EXPIRE);
-            iter = m_spellAuraHolders.begin();
-        }
-        else
-        {
-            ++iter;
         }
     }
 
@@ -10398,6 +10396,7 @@ void Unit::UpdateModelData()
     {
         // we expect values in database to be relative to scale = 1.0
         SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, GetObjectScale() * modelInfo->bounding_radius);
+        UpdateObjectIndex();
 
         // never actually update combat_reach for player, it's always the same. Below player case is for initialization
         if (GetTypeId() == TYPEID_PLAYER)
@@ -11094,8 +11093,15 @@ void Unit::OnRelocated()
         m_last_notified_position.y = GetPositionY();
         m_last_notified_position.z = GetPositionZ();
 
-        GetViewPoint().Call_UpdateVisibilityForOwner();
-        UpdateObjectVisibility();
+        if (World::IsVisibilityUpdateDeferred())
+        {
+            GetMap()->AddVisibilityUpdate(this);
+        }
+        else
+        {
+            GetViewPoint().Call_UpdateVisibilityForOwner();
+            UpdateObjectVisibility();
+        }
     }
     ScheduleAINotify(World::GetRelocationAINotifyDelay());
 }
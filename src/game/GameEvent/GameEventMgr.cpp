@@ -103,6 +103,11 @@ void GameEventMgr::StartEvent(uint16 event_id, bool overwrite /*=false*/, bool r
         {
             mGameEvent[event_id].end = mGameEvent[event_id].start + mGameEvent[event_id].length;
         }
+
+        if (m_IsGameEventsInit)
+        {
+            ScheduleCheck(event_id, time(NULL));
+        }
     }
 #ifdef ENABLE_ELUNA
     if (Eluna* e = sWorld.GetEluna())
@@ -125,6 +130,11 @@ void GameEventMgr::StopEvent(uint16 event_id, bool overwrite)
         {
             mGameEvent[event_id].end = mGameEvent[event_id].start + mGameEvent[event_id].length;
         }
+
+        if (m_IsGameEventsInit)
+        {
+            ScheduleCheck(event_id, time(NULL));
+        }
     }
 #ifdef ENABLE_ELUNA
     if (Eluna* e = sWorld.GetEluna())
@@ -652,45 +662,83 @@ uint32 GameEventMgr::Update(ActiveEvents const* activeAtShutdown /*= NULL*/)
 {
     time_t currenttime = time(NULL);
 
-    uint32 nextEventDelay = max_ge_check_delay;             // 1 day
-    uint32 calcDelay;
-    for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+    if (!m_IsGameEventsInit)
+    {
+        m_CheckSchedule = CheckSchedule();
+        m_NextCheckTimes.assign(mGameEvent.size(), 0);
+
+        for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+        {
+            CheckEvent(itr, currenttime, activeAtShutdown);
+        }
+    }
+    else
     {
-        // sLog.outErrorDb("Checking event %u",itr);
-        if (CheckOneGameEvent(itr, currenttime))
+        // only events with a start or end due are checked
+        while (!m_CheckSchedule.empty() && m_CheckSchedule.top().first <= currenttime)
         {
-            // DEBUG_LOG("GameEvent %u is active",itr->first);
-            if (!IsActiveEvent(itr))
+            ScheduledCheck check = m_CheckSchedule.top();
+            m_CheckSchedule.pop();
+
+            if (m_NextCheckTimes[check.second] == check.first)
             {
-                bool resume = activeAtShutdown && (activeAtShutdown->find(itr) != activeAtShutdown->end());
-                StartEvent(itr, false, resume);
+                CheckEvent(check.second, currenttime, activeAtShutdown);
             }
         }
+    }
+
+    uint32 nextEventDelay = max_ge_check_delay;             // 1 day
+    if (!m_CheckSchedule.empty() && m_CheckSchedule.top().first - currenttime < time_t(nextEventDelay))
+    {
+        nextEventDelay = uint32(m_CheckSchedule.top().first - currenttime);
+    }
+
+    BASIC_LOG("Next game event check in %u seconds.", nextEventDelay);
+    return nextEventDelay * IN_MILLISECONDS;
+}
+
+void GameEventMgr::CheckEvent(uint16 event_id, time_t currenttime, ActiveEvents const* activeAtShutdown)
+{
+    if (CheckOneGameEvent(event_id, currenttime))
+    {
+        if (!IsActiveEvent(event_id))
+        {
+            bool resume = activeAtShutdown && (activeAtShutdown->find(event_id) != activeAtShutdown->end());
+            StartEvent(event_id, false, resume);
+        }
+    }
+    else
+    {
+        if (IsActiveEvent(event_id))
+        {
+            StopEvent(event_id);
+        }
         else
         {
-            // DEBUG_LOG("GameEvent %u is not active",itr->first);
-            if (IsActiveEvent(itr))
+            if (!m_IsGameEventsInit)
             {
-                StopEvent(itr);
+                int16 event_nid = (-1) * (event_id);
+                // spawn all negative ones for this event
+                GameEventSpawn(event_nid);
             }
-            else
-            {
-                if (!m_IsGameEventsInit)
-                {
-                    int16 event_nid = (-1) * (itr);
-                    // spawn all negative ones for this event
-                    GameEventSpawn(event_nid);
-                }
-            }
-        }
-        calcDelay = NextCheck(itr);
-        if (calcDelay < nextEventDelay)
-        {
-            nextEventDelay = calcDelay;
         }
     }
-    BASIC_LOG("Next game event check in %u seconds.", nextEventDelay + 1);
-    return (nextEventDelay + 1) * IN_MILLISECONDS;          // Add 1 second to be sure event has started/stopped at next call
+
+    ScheduleCheck(event_id, currenttime);
+}
+
+void GameEventMgr::ScheduleCheck(uint16 event_id, time_t currenttime)
+{
+    // Add 1 second to be sure event has started/stopped at the check
+    time_t checkTime = currenttime + NextCheck(event_id) + 1;
+
+    if (event_id >= m_NextCheckTimes.size())
+    {
+        m_NextCheckTimes.resize(mGameEvent.size(), 0);
+    }
+
+    m_NextCheckTimes[event_id] = checkTime;
+    m_CheckSchedule.push(ScheduledCheck(checkTime, event_id));
 }
 
 void GameEventMgr::UnApplyEvent(uint16 event_id)
@@ -739,6 +787,25 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id, bool resume)
     }
 }
 
+struct GameEventJobInMapsWorker
+{
+    explicit GameEventJobInMapsWorker(GameEventSpawnJob const& job) : i_job(job) {}
+
+    void operator()(Map* map)
+    {
+        map->AddGameEventJob(i_job);
+    }
+
+    GameEventSpawnJob i_job;
+};
+
+// maps apply the job during their own update, see Map::ProcessGameEventJobs
+static void AddGameEventJobInMaps(uint32 mapId, GameEventSpawnJob const& job)
+{
+    GameEventJobInMapsWorker worker(job);
+    sMapMgr.DoForAllMapsWithMapId(mapId, worker);
+}
+
 void GameEventMgr::GameEventSpawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
@@ -769,7 +836,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
             sObjectMgr.AddCreatureToGrid(*itr, data);
 
-            Creature::SpawnInMaps(*itr, data);
+            AddGameEventJobInMaps(data->mapid, GameEventSpawnJob(GAME_EVENT_JOB_SPAWN_CREATURE, *itr));
         }
     }
 
@@ -799,7 +866,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
             sObjectMgr.AddGameobjectToGrid(*itr, data);
 
-            GameObject::SpawnInMaps(*itr, data);
+            AddGameEventJobInMaps(data->mapid, GameEventSpawnJob(GAME_EVENT_JOB_SPAWN_GAMEOBJECT, *itr));
         }
     }
 
@@ -848,7 +915,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
             sObjectMgr.RemoveCreatureFromGrid(*itr, data);
 
             // Remove spawned cases
-            Creature::AddToRemoveListInMaps(*itr, data);
+            AddGameEventJobInMaps(data->mapid, GameEventSpawnJob(GAME_EVENT_JOB_DESPAWN_CREATURE, *itr));
         }
     }
 
@@ -878,7 +945,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
             sObjectMgr.RemoveGameobjectFromGrid(*itr, data);
 
             // Remove spawned cases
-            GameObject::AddToRemoveListInMaps(*itr, data);
+            AddGameEventJobInMaps(data->mapid, GameEventSpawnJob(GAME_EVENT_JOB_DESPAWN_GAMEOBJECT, *itr));
         }
     }
 
@@ -925,31 +992,6 @@ GameEventCreatureData const* GameEventMgr::GetCreatureUpdateDataForActiveEvent(u
     return NULL;
 }
 
-struct GameEventUpdateCreatureDataInMapsWorker
-{
-    GameEventUpdateCreatureDataInMapsWorker(ObjectGuid guid, CreatureData const* data, GameEventCreatureData* event_data, bool activate)
-        : i_guid(guid), i_data(data), i_event_data(event_data), i_activate(activate) {}
-
-    void operator()(Map* map)
-    {
-        if (Creature* pCreature = map->GetCreature(i_guid))
-        {
-            pCreature->UpdateEntry(i_data->id, TEAM_NONE, i_data, i_activate ? i_event_data : NULL);
-
-            // spells not casted for event remove case (sent NULL into update), do it
-            if (!i_activate)
-            {
-                pCreature->ApplyGameEventSpells(i_event_data, false);
-            }
-        }
-    }
-
-    ObjectGuid i_guid;
-    CreatureData const* i_data;
-    GameEventCreatureData* i_event_data;
-    bool i_activate;
-};
-
 void GameEventMgr::UpdateCreatureData(int16 event_id, bool activate)
 {
     for (GameEventCreatureDataList::iterator itr = mGameEventCreatureData[event_id].begin(); itr != mGameEventCreatureData[event_id].end(); ++itr)
@@ -962,8 +1004,7 @@ void GameEventMgr::UpdateCreatureData(int16 event_id, bool activate)
         }
 
         // Update if spawned
-        GameEventUpdateCreatureDataInMapsWorker worker(data->GetObjectGuid(itr->first), data, &itr->second, activate);
-        sMapMgr.DoForAllMapsWithMapId(data->mapid, worker);
+        AddGameEventJobInMaps(data->mapid, GameEventSpawnJob(GAME_EVENT_JOB_UPDATE_CREATURE, itr->first, &itr->second, activate));
     }
 }
 
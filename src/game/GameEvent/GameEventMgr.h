@@ -29,6 +29,8 @@
 #include "SharedDefines.h"
 #include "Platform/Define.h"
 
+#include <queue>
+
 #define max_ge_check_delay 86400                            // 1 day in seconds
 
 class Creature;
@@ -103,6 +105,8 @@ class GameEventMgr
         void UpdateCreatureData(int16 event_id, bool activate);
         void UpdateEventQuests(uint16 event_id, bool activate);
         void SendEventMails(int16 event_id);
+        void CheckEvent(uint16 event_id, time_t currenttime, ActiveEvents const* activeAtShutdown);
+        void ScheduleCheck(uint16 event_id, time_t currenttime);
        // To implement for GameObjectAI - see code in CMangos
        // void OnEventHappened(uint16 event_id, bool activate, bool resume);
        // void ComputeEventStartAndEndTime(GameEventData& data);
@@ -134,6 +138,12 @@ class GameEventMgr
         GameEventDataMap  mGameEvent;
         ActiveEvents m_ActiveEvents;
         bool m_IsGameEventsInit;
+
+        // next start/stop check of every event, earliest first; stale entries are skipped by m_NextCheckTimes
+        typedef std::pair<time_t, uint16> ScheduledCheck;
+        typedef std::priority_queue<ScheduledCheck, std::vector<ScheduledCheck>, std::greater<ScheduledCheck> > CheckSchedule;
+        CheckSchedule m_CheckSchedule;
+        std::vector<time_t> m_NextCheckTimes;
 };
 
 #define sGameEventMgr MaNGOS::Singleton<GameEventMgr>::Instance()
@@ -33,6 +33,7 @@
 #include "UpdateData.h"
 #include "Chat.h"
 #include "World.h"
+#include "QueryResponseCache.h"
 
 void WorldSession::HandleSplitItemOpcode(WorldPacket& recv_data)
 {
@@ -327,11 +328,17 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recv_data)
 
     DETAIL_LOG("STORAGE: Item Query = %u", item);
 
+    int loc_idx = GetSessionDbLocaleIndex();
+    uint32 generation;
+    if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_ITEM, item, loc_idx, generation))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
     ItemPrototype const* pProto = ObjectMgr::GetItemPrototype(item);
     if (pProto)
     {
-        int loc_idx = GetSessionDbLocaleIndex();
-
         std::string name = pProto->Name1;
         std::string description = pProto->Description;
         sObjectMgr.GetItemLocaleStrings(pProto->ItemId, loc_idx, &name, &description);
@@ -524,6 +531,7 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recv_data)
         data << pProto->Area;
         data << pProto->Map;                                // Added in 1.12.x & 2.0.1 client branch
         data << pProto->BagFamily;
+        sQueryResponseCache.Store(QUERY_RESPONSE_ITEM, item, loc_idx, data, generation);
         SendPacket(&data);
     }
     else
@@ -1282,10 +1290,17 @@ void WorldSession::HandleItemNameQueryOpcode(WorldPacket& recv_data)
     recv_data.read_skip<uint64>();                          // guid
 
     DEBUG_LOG("WORLD: CMSG_ITEM_NAME_QUERY %u", itemid);
-    if (ItemPrototype const *pProto = ObjectMgr::GetItemPrototype(itemid))
+
+    int loc_idx = GetSessionDbLocaleIndex();
+    uint32 generation;
+    if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_ITEM_NAME, itemid, loc_idx, generation))
     {
-        int loc_idx = GetSessionDbLocaleIndex();
+        SendPacket(response.get());
+        return;
+    }
 
+    if (ItemPrototype const *pProto = ObjectMgr::GetItemPrototype(itemid))
+    {
         std::string name = pProto->Name1;
         sObjectMgr.GetItemLocaleStrings(pProto->ItemId, loc_idx, &name);
 
@@ -1294,6 +1309,7 @@ void WorldSession::HandleItemNameQueryOpcode(WorldPacket& recv_data)
         data << uint32(pProto->ItemId);
         data << name;
         //data << uint32(pProto->InventoryType);    [-ZERO]
+        sQueryResponseCache.Store(QUERY_RESPONSE_ITEM_NAME, itemid, loc_idx, data, generation);
         SendPacket(&data);
         return;
     }
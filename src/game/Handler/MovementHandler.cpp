@@ -34,6 +34,7 @@
 #include "WaypointMovementGenerator.h"
 #include "MapPersistentStateMgr.h"
 #include "ObjectMgr.h"
+#include "World.h"
 
 #define MOVEMENT_PACKET_TIME_DELAY 300
 
@@ -313,6 +314,19 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     WorldPacket data(opcode, uint16(recv_data.size() + 2));
     data << mover->GetPackGUID();             // write guid
     movementInfo.Write(data);                               // write data
+
+    if (sWorld.getConfig(CONFIG_BOOL_MOVEMENT_RELAY))
+    {
+        // heartbeat can wait for a newer one, any other movement replaces it and goes out now
+        if (opcode == MSG_MOVE_HEARTBEAT)
+        {
+            mover->GetMap()->GetMovementRelay().QueueHeartbeat(mover, _player->GetObjectGuid(), data);
+            return;
+        }
+
+        mover->GetMap()->GetMovementRelay().DropHeartbeat(mover);
+    }
+
     mover->SendMessageToSetExcept(&data, _player);
 }
 
@@ -472,6 +486,12 @@ void WorldSession::HandleMoveKnockBackAck(WorldPacket& recv_data)
     data << movementInfo.GetJumpInfo().cosAngle;
     data << movementInfo.GetJumpInfo().xyspeed;
     data << movementInfo.GetJumpInfo().velocity;
+
+    if (sWorld.getConfig(CONFIG_BOOL_MOVEMENT_RELAY))
+    {
+        mover->GetMap()->GetMovementRelay().DropHeartbeat(mover);
+    }
+
     mover->SendMessageToSetExcept(&data, _player);
 }
 
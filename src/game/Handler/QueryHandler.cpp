@@ -36,6 +36,7 @@
 #include "Player.h"
 #include "NPCHandler.h"
 #include "SQLStorages.h"
+#include "QueryResponseCache.h"
 
 void WorldSession::SendNameQueryOpcode(Player* p)
 {
@@ -145,42 +146,47 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recv_data)
     {
         int loc_idx = GetSessionDbLocaleIndex();
 
-        char const* name = ci->Name;
-        char const* subName = ci->SubName;
-        sObjectMgr.GetCreatureLocaleStrings(entry, loc_idx, &name, &subName);
-
-        DETAIL_LOG("WORLD: CMSG_CREATURE_QUERY '%s' - Entry: %u.", ci->Name, entry);
-        // guess size
-        WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
-        data << uint32(entry);                              // creature entry
-        data << name;
-        data << uint8(0) << uint8(0) << uint8(0);           // name2, name3, name4, always empty
-        data << subName;
-        data << uint32(ci->CreatureTypeFlags);              // flags
-        if (unit)
+        uint32 generation;
+        QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_CREATURE, entry, loc_idx, generation);
+        if (!response)
         {
-            data << uint32(((unit->IsPet()) ? 0 : ci->CreatureType));  // CreatureType.dbc   wdbFeild8
-        }
-        else
-        {
-            data << uint32(ci->CreatureType);
+            char const* name = ci->Name;
+            char const* subName = ci->SubName;
+            sObjectMgr.GetCreatureLocaleStrings(entry, loc_idx, &name, &subName);
+
+            DETAIL_LOG("WORLD: CMSG_CREATURE_QUERY '%s' - Entry: %u.", ci->Name, entry);
+            // guess size
+            WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
+            data << uint32(entry);                          // creature entry
+            data << name;
+            data << uint8(0) << uint8(0) << uint8(0);       // name2, name3, name4, always empty
+            data << subName;
+            data << uint32(ci->CreatureTypeFlags);          // flags
+            data << uint32(ci->CreatureType);               // CreatureType.dbc   wdbFeild8, set per unit below
+            data << uint32(ci->Family);                     // CreatureFamily.dbc
+            data << uint32(ci->Rank);                       // Creature Rank (elite, boss, etc)
+            data << uint32(0);                              // unknown        wdbFeild11
+            data << uint32(ci->PetSpellDataId);             // Id from CreatureSpellData.dbc    wdbField12
+            data << uint32(0);                              // DisplayID      wdbFeild13, set per unit below
+            data << uint8(ci->civilian);                    // wdbFeild14
+            data << uint8(ci->RacialLeader);
+            response = sQueryResponseCache.Store(QUERY_RESPONSE_CREATURE, entry, loc_idx, data, generation);
         }
 
-        data << uint32(ci->Family);                         // CreatureFamily.dbc
-        data << uint32(ci->Rank);                           // Creature Rank (elite, boss, etc)
-        data << uint32(0);                                  // unknown        wdbFeild11
-        data << uint32(ci->PetSpellDataId);                 // Id from CreatureSpellData.dbc    wdbField12
+        // unit dependent fields, at a fixed distance from the packet end
+        WorldPacket data(*response);
         if (unit)
         {
-            data << unit->GetUInt32Value(UNIT_FIELD_DISPLAYID);  // DisplayID      wdbFeild13
+            if (unit->IsPet())
+            {
+                data.put<uint32>(data.size() - 26, 0);      // CreatureType
+            }
+            data.put<uint32>(data.size() - 6, unit->GetUInt32Value(UNIT_FIELD_DISPLAYID));
         }
         else
         {
-            data << uint32(Creature::ChooseDisplayId(ci));   // workaround, way to manage models must be fixed
+            data.put<uint32>(data.size() - 6, Creature::ChooseDisplayId(ci));  // workaround, way to manage models must be fixed
         }
-
-        data << uint8(ci->civilian);                       // wdbFeild14
-        data << uint8(ci->RacialLeader);
         SendPacket(&data);
         DEBUG_LOG("WORLD: Sent SMSG_CREATURE_QUERY_RESPONSE");
     }
@@ -203,12 +209,19 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recv_data)
     ObjectGuid guid;
     recv_data >> guid;
 
+    int loc_idx = GetSessionDbLocaleIndex();
+    uint32 generation;
+    if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_GAMEOBJECT, entryID, loc_idx, generation))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
     const GameObjectInfo* info = ObjectMgr::GetGameObjectInfo(entryID);
     if (info)
     {
         std::string Name = info->name;
 
-        int loc_idx = GetSessionDbLocaleIndex();
         if (loc_idx >= 0)
         {
             GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(entryID);
@@ -230,6 +243,7 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recv_data)
         data << uint8(0);                           // one more name, client handles it a bit differently
         data.append(info->raw.data, 24);            // these are read as int32
         // data << float(info->size);               // [-ZERO] go size: not in Zero
+        sQueryResponseCache.Store(QUERY_RESPONSE_GAMEOBJECT, entryID, loc_idx, data, generation);
         SendPacket(&data);
         DEBUG_LOG("WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
@@ -306,6 +320,14 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
 
     _player->SetTargetGuid(guid);
 
+    int loc_idx = GetSessionDbLocaleIndex();
+    uint32 generation;
+    if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_NPC_TEXT, textID, loc_idx, generation))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
     GossipText const* pGossip = sObjectMgr.GetGossipText(textID);
 
     WorldPacket data(SMSG_NPC_TEXT_UPDATE, 100);            // guess size
@@ -336,8 +358,6 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
             Text_1[i] = pGossip->Options[i].Text_1;
         }
 
-        int loc_idx = GetSessionDbLocaleIndex();
-
         sObjectMgr.GetNpcTextLocaleStringsAll(textID, loc_idx, &Text_0, &Text_1);
 
         for (int i = 0; i < MAX_GOSSIP_TEXT_OPTIONS; ++i)
@@ -372,6 +392,11 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
         }
     }
 
+    // client chosen ids of missing texts are not kept
+    if (pGossip)
+    {
+        sQueryResponseCache.Store(QUERY_RESPONSE_NPC_TEXT, textID, loc_idx, data, generation);
+    }
     SendPacket(&data);
 
     DEBUG_LOG("WORLD: Sent SMSG_NPC_TEXT_UPDATE");
@@ -385,9 +410,18 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
     recv_data >> pageID;
     recv_data.read_skip<uint64>();                          // guid
 
+    int loc_idx = GetSessionDbLocaleIndex();
     while (pageID)
     {
         PageText const* pPage = sPageTextStore.LookupEntry<PageText>(pageID);
+        uint32 generation;
+        if (QueryResponsePtr response = sQueryResponseCache.Get(QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx, generation))
+        {
+            SendPacket(response.get());
+            pageID = pPage ? pPage->Next_Page : 0;
+            continue;
+        }
+
         // guess size
         WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
         data << pageID;
@@ -396,13 +430,11 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
         {
             data << "Item page missing.";
             data << uint32(0);
-            pageID = 0;
         }
         else
         {
             std::string Text = pPage->Text;
 
-            int loc_idx = GetSessionDbLocaleIndex();
             if (loc_idx >= 0)
             {
                 PageTextLocale const* pl = sObjectMgr.GetPageTextLocale(pageID);
@@ -417,8 +449,12 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
 
             data << Text;
             data << uint32(pPage->Next_Page);
-            pageID = pPage->Next_Page;
         }
+        if (pPage)
+        {
+            sQueryResponseCache.Store(QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx, data, generation);
+        }
+        pageID = pPage ? pPage->Next_Page : 0;
         SendPacket(&data);
 
         DEBUG_LOG("WORLD: Sent SMSG_PAGE_TEXT_QUERY_RESPONSE");
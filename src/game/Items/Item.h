@@ -29,6 +29,7 @@
 #include "Object.h"
 #include "LootMgr.h"
 #include "ItemPrototype.h"
+#include "Utilities/ObjectPool.h"
 
 struct SpellEntry;
 class Bag;
@@ -234,6 +235,8 @@ bool ItemCanGoIntoBag(ItemPrototype const* proto, ItemPrototype const* pBagProto
 
 class Item : public Object
 {
+        MANGOS_POOLED_OBJECT(Item)
+
     public:
         static Item* CreateItem(uint32 item, uint32 count, Player const* player = NULL, uint32 randomPropertyId = 0);
         Item* CloneItem(uint32 count, Player const* player = NULL) const;
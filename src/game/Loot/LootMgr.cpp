@@ -83,10 +83,20 @@ class LootTemplate::LootGroup                               // A set of loot def
 
         void Verify(LootStore const& lootstore, uint32 id, uint32 group_id) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+        void BuildAliasTable();                             // Precomputes Roll() results, called after loading
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+        // Alias method table over all entries plus the empty drop, one slot per outcome
+        struct AliasSlot
+        {
+            float threshold;                                // keep the slot's own outcome below this roll
+            uint16 alias;                                   // outcome taken otherwise
+        };
+        std::vector<AliasSlot> Aliases;
+
+        LootStoreItem const* GetOutcome(uint32 index) const;
         LootStoreItem const* Roll() const;                  // Rolls an item from the group, returns NULL if all miss their chances
 };
 
@@ -194,6 +204,11 @@ void LootStore::LoadLootTable()
 
         Verify();                                           // Checks validity of the loot store
 
+        for (LootTemplateMap::iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+        {
+            itr->second->BuildAliasTables();
+        }
+
         sLog.outString(">> Loaded %u loot definitions (%zu templates) from table %s", count, m_LootTemplates.size(), GetName());
         sLog.outString();
     }
@@ -1019,9 +1034,106 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem& item)
     }
 }
 
+/**
+ * Converts the chances of the group into an alias table (Vose's method), so Roll() needs one
+ * slot pick and one compare instead of walking the explicitly chanced list.
+ *
+ * Outcomes are the explicitly chanced entries, the equal chanced entries and the empty drop.
+ * Their probabilities are the ones of the linear walk: entries are checked in order, an entry
+ * with 100% takes everything left, and the rest is shared by the equal chanced entries.
+ */
+void LootTemplate::LootGroup::BuildAliasTable()
+{
+    Aliases.clear();
+
+    uint32 explicitCount = ExplicitlyChanced.size();
+    uint32 outcomes = explicitCount + EqualChanced.size() + 1;
+    if (outcomes > std::numeric_limits<uint16>::max())
+    {
+        return;                                             // keep the linear walk
+    }
+
+    std::vector<double> weights(outcomes, 0.0);
+
+    double left = 1.0;
+    for (uint32 i = 0; i < explicitCount && left > 0.0; ++i)
+    {
+        double chance = ExplicitlyChanced[i].chance >= 100.0f ? left : std::min(left, ExplicitlyChanced[i].chance / 100.0);
+        weights[i] = chance;
+        left -= chance;
+    }
+
+    if (!EqualChanced.empty())
+    {
+        for (uint32 i = 0; i < EqualChanced.size(); ++i)
+        {
+            weights[explicitCount + i] = left / EqualChanced.size();
+        }
+    }
+    else
+    {
+        weights[outcomes - 1] = left;
+    }
+
+    Aliases.resize(outcomes);
+
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < outcomes; ++i)
+    {
+        weights[i] *= outcomes;
+        (weights[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32 s = small.back();
+        small.pop_back();
+        uint32 l = large.back();
+
+        Aliases[s].threshold = float(weights[s]);
+        Aliases[s].alias = l;
+
+        weights[l] -= 1.0 - weights[s];
+        if (weights[l] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+
+    // leftovers are 1.0 up to rounding errors
+    for (uint32 i = 0; i < large.size(); ++i)
+    {
+        Aliases[large[i]].threshold = 1.0f;
+        Aliases[large[i]].alias = large[i];
+    }
+    for (uint32 i = 0; i < small.size(); ++i)
+    {
+        Aliases[small[i]].threshold = 1.0f;
+        Aliases[small[i]].alias = small[i];
+    }
+}
+
+LootStoreItem const* LootTemplate::LootGroup::GetOutcome(uint32 index) const
+{
+    if (index < ExplicitlyChanced.size())
+    {
+        return &ExplicitlyChanced[index];
+    }
+
+    index -= ExplicitlyChanced.size();
+    return index < EqualChanced.size() ? &EqualChanced[index] : NULL;
+}
+
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll() const
 {
+    if (!Aliases.empty())
+    {
+        uint32 slot = urand(0, Aliases.size() - 1);
+        return GetOutcome(rand_norm_f() < Aliases[slot].threshold ? slot : Aliases[slot].alias);
+    }
+
     if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
     {
         float Roll = rand_chance_f();
@@ -1486,6 +1598,14 @@ void LootTemplate::Verify(LootStore const& lootstore, uint32 id) const
     // TODO: References validity checks
 }
 
+void LootTemplate::BuildAliasTables()
+{
+    for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
+    {
+        i->BuildAliasTable();
+    }
+}
+
 void LootTemplate::CheckLootRefs(LootIdSet* ref_set) const
 {
     for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
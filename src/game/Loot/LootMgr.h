@@ -234,6 +234,8 @@ class LootTemplate
         // Checks integrity of the template
         void Verify(LootStore const& store, uint32 Id) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+        // Precomputes the group rolls, called once the template is loaded
+        void BuildAliasTables();
     private:
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
@@ -387,6 +389,7 @@ extern LootStore LootTemplates_Mail;
 extern LootStore LootTemplates_Pickpocketing;
 extern LootStore LootTemplates_Skinning;
 extern LootStore LootTemplates_Disenchant;
+extern LootStore LootTemplates_Reference;
 
 void LoadLootTemplates_Creature();
 void LoadLootTemplates_Fishing();
@@ -282,35 +282,7 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
     uint32 mailId = sObjectMgr.GenerateMailID();
 
     time_t deliver_time = time(NULL) + deliver_delay;
-
-    // expire time if COD 3 days, if no COD 30 days, if auction sale pending 1 hour
-    uint32 expire_delay;
-
-    // Normal Mail Expire Timer
-    expire_delay = 30 * DAY;
-
-    // auction mail without any items and money (auction sale note) pending 1 hour
-    if (sender.GetMailMessageType() == MAIL_AUCTION && m_items.empty() && !m_money)
-    {
-        expire_delay = HOUR;
-    }
-    // mail from battlemaster (rewardmarks) should last only one day
-    else if (sender.GetMailMessageType() == MAIL_CREATURE && sBattleGroundMgr.GetBattleMasterBG(sender.GetSenderId()) != BATTLEGROUND_TYPE_NONE)
-    {
-        expire_delay = DAY;
-    }
-    else if (m_COD)
-    {
-        // COD Mail Expire Timer
-        expire_delay = 3 * DAY;
-    }
-    //Mail from GM
-    else if (sender.GetStationery() == MAIL_STATIONERY_GM)
-    {
-        expire_delay = 90 * DAY;
-    }
-
-    time_t expire_time = deliver_time + expire_delay;
+    time_t expire_time = deliver_time + GetExpireDelay(sender);
 
     // Add to DB
     std::string safe_subject = GetSubject();
@@ -376,6 +348,166 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
     }
 }
 
+/**
+ * Returns how long a mail from this draft stays in the mailbox.
+ *
+ * @param sender               The MailSender from which this mail is originated.
+ */
+uint32 MailDraft::GetExpireDelay(MailSender const& sender) const
+{
+    // expire time if COD 3 days, if no COD 30 days, if auction sale pending 1 hour
+    uint32 expire_delay;
+
+    // Normal Mail Expire Timer
+    expire_delay = 30 * DAY;
+
+    // auction mail without any items and money (auction sale note) pending 1 hour
+    if (sender.GetMailMessageType() == MAIL_AUCTION && m_items.empty() && !m_money)
+    {
+        expire_delay = HOUR;
+    }
+    // mail from battlemaster (rewardmarks) should last only one day
+    else if (sender.GetMailMessageType() == MAIL_CREATURE && sBattleGroundMgr.GetBattleMasterBG(sender.GetSenderId()) != BATTLEGROUND_TYPE_NONE)
+    {
+        expire_delay = DAY;
+    }
+    else if (m_COD)
+    {
+        // COD Mail Expire Timer
+        expire_delay = 3 * DAY;
+    }
+    //Mail from GM
+    else if (sender.GetStationery() == MAIL_STATIONERY_GM)
+    {
+        expire_delay = 90 * DAY;
+    }
+
+    return expire_delay;
+}
+
+/// Size after which a multi-row insert of SendMailToOffline is queued and a new one started
+static const size_t MAIL_BATCH_STATEMENT_SIZE = 256 * 1024;
+
+/**
+ * Sends a mail to many offline characters at once.
+ *
+ * Mail and item ids are reserved as ranges and all rows are queued as one async transaction,
+ * so the caller never waits on the character database. Template items of offline mails are
+ * generated when the mail is loaded, like in SendMailTo.
+ *
+ * @param receivers            The low guids of the receivers, expected to be existing characters.
+ * @param sender               The MailSender from which this mail is originated.
+ * @param checked              The mask used to specify the mail.
+ */
+void MailDraft::SendMailToOffline(std::vector<uint32> const& receivers, MailSender const& sender, MailCheckMask checked)
+{
+    if (receivers.empty())
+    {
+        return;
+    }
+
+    // item_instance data of the copies only differs in the object guid, so build it once
+    struct ItemCopy
+    {
+        uint32 entry;
+        std::string data;                                   // values after OBJECT_FIELD_GUID and its high part
+        uint32 firstGuid;
+    };
+
+    std::vector<ItemCopy> itemCopies;
+    for (MailItemMap::const_iterator mailItemIter = m_items.begin(); mailItemIter != m_items.end(); ++mailItemIter)
+    {
+        Item* newitem = mailItemIter->second->CloneItem(mailItemIter->second->GetCount());
+        if (!newitem)
+        {
+            continue;
+        }
+
+        ItemCopy copy;
+        copy.entry = newitem->GetEntry();
+
+        std::ostringstream ss;
+        for (uint16 i = OBJECT_FIELD_GUID + 2; i < newitem->GetValuesCount(); ++i)
+        {
+            ss << newitem->GetUInt32Value(i) << " ";
+        }
+        copy.data = ss.str();
+        copy.firstGuid = sObjectMgr.GenerateItemLowGuidRange(receivers.size());
+        itemCopies.push_back(copy);
+
+        delete newitem;
+    }
+
+    uint32 firstMailId = sObjectMgr.GenerateMailIDRange(receivers.size());
+
+    time_t deliver_time = time(NULL);
+    time_t expire_time = deliver_time + GetExpireDelay(sender);
+
+    std::string safe_subject = GetSubject();
+    CharacterDatabase.escape_string(safe_subject);
+
+    std::string safe_body = GetBody();
+    CharacterDatabase.escape_string(safe_body);
+
+    std::ostringstream mailValues;
+    mailValues << "', '" << sender.GetMailMessageType() << "', '" << uint32(sender.GetStationery()) << "', '" << GetMailTemplateId() << "', '" << sender.GetSenderId() << "', '";
+
+    std::ostringstream mailTail;
+    mailTail << "', '" << safe_subject << "', '" << safe_body << "', '" << (itemCopies.empty() ? 0 : 1) << "', '" << uint64(expire_time) << "','" << uint64(deliver_time)
+             << "', '" << m_money << "', '" << m_COD << "', '" << uint32(checked) << "')";
+
+    std::string const mailPrefix = mailValues.str();
+    std::string const mailSuffix = mailTail.str();
+
+    std::string mailSql, itemSql, mailItemSql;
+
+    CharacterDatabase.BeginTransaction();
+
+    for (size_t r = 0; r < receivers.size(); ++r)
+    {
+        uint32 receiver = receivers[r];
+        uint32 mailId = firstMailId + r;
+
+        std::ostringstream ss;
+        ss << (mailSql.empty() ? "INSERT INTO `mail` (`id`,`messageType`,`stationery`,`mailTemplateId`,`sender`,`receiver`,`subject`,`body`,`has_items`,`expire_time`,`deliver_time`,`money`,`cod`,`checked`) VALUES " : ",")
+           << "('" << mailId << mailPrefix << receiver << mailSuffix;
+        mailSql += ss.str();
+
+        for (size_t i = 0; i < itemCopies.size(); ++i)
+        {
+            uint32 itemGuid = itemCopies[i].firstGuid + r;
+            uint64 rawGuid = ObjectGuid(HIGHGUID_ITEM, itemGuid).GetRawValue();
+
+            ss.str("");
+            ss << (itemSql.empty() ? "INSERT INTO `item_instance` (`guid`,`owner_guid`,`data`,`text`) VALUES " : ",")
+               << "('" << itemGuid << "', '0', '" << uint32(rawGuid) << " " << uint32(rawGuid >> 32) << " " << itemCopies[i].data << "', '')";
+            itemSql += ss.str();
+
+            ss.str("");
+            ss << (mailItemSql.empty() ? "INSERT INTO `mail_items` (`mail_id`,`item_guid`,`item_template`,`receiver`) VALUES " : ",")
+               << "('" << mailId << "', '" << itemGuid << "', '" << itemCopies[i].entry << "', '" << receiver << "')";
+            mailItemSql += ss.str();
+        }
+
+        // items first, a mail_items row never points to a missing item
+        if (mailSql.size() + itemSql.size() + mailItemSql.size() >= MAIL_BATCH_STATEMENT_SIZE || r + 1 == receivers.size())
+        {
+            if (!itemSql.empty())
+            {
+                CharacterDatabase.Execute(itemSql.c_str());
+                CharacterDatabase.Execute(mailItemSql.c_str());
+            }
+            CharacterDatabase.Execute(mailSql.c_str());
+
+            mailSql.clear();
+            itemSql.clear();
+            mailItemSql.clear();
+        }
+    }
+
+    CharacterDatabase.CommitTransaction();
+}
+
 /**
  * Generate items from template at mails loading (this happens when mail with mail template items send in time when receiver has been offline)
  *
@@ -255,12 +255,21 @@ class MailDraft
     public:                                                 // finishers
         void SendReturnToSender(uint32 sender_acc, ObjectGuid sender_guid, ObjectGuid receiver_guid);
         void SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0);
+        /**
+         * Writes copies of this mail for existing offline characters with multi-row inserts, the draft itself is not consumed.
+         *
+         * @param receivers    low guids of the receivers, none of them may be online.
+         * @param sender       The MailSender from which this mail is originated.
+         * @param checked      The mask used to specify the mail.
+         */
+        void SendMailToOffline(std::vector<uint32> const& receivers, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE);
     private:
         MailDraft(MailDraft const&);                        // trap decl, no body, mail draft must cloned only explicitly...
         MailDraft& operator=(MailDraft const&);             // trap decl, no body, ...because items clone is high price operation
 
         void deleteIncludedItems(bool inDB = false);
         bool prepareItems(Player* receiver);                ///< called from SendMailTo for generate mailTemplateBase items
+        uint32 GetExpireDelay(MailSender const& sender) const;
 
         /// The ID of the template associated with this MailDraft.
         uint16      m_mailTemplateId;
@@ -89,12 +89,20 @@ void MassMailMgr::Update(bool sendall /*= false*/)
     }
 
     uint32 maxcount = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
+    uint32 maxoffline = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_OFFLINE_BATCH);
 
     do
     {
         MassMail& task = m_massMails.front();
 
-        while (!task.m_receivers.empty() && (sendall || maxcount > 0))
+        if (!task.m_total)
+        {
+            task.m_total = task.m_receivers.size();
+        }
+
+        // online receivers need the in game mail state updated, offline ones only need DB rows
+        std::vector<uint32> offline;
+        while (!task.m_receivers.empty() && (sendall || (maxcount > 0 && offline.size() < maxoffline)))
         {
             uint32 receiver_lowguid = *task.m_receivers.begin();
             task.m_receivers.erase(task.m_receivers.begin());
@@ -102,38 +110,79 @@ void MassMailMgr::Update(bool sendall /*= false*/)
             ObjectGuid receiver_guid = ObjectGuid(HIGHGUID_PLAYER, receiver_lowguid);
             Player* receiver = sObjectMgr.GetPlayer(receiver_guid);
 
-            // last case. can be just send
-            if (task.m_receivers.empty())
+            // the last receiver gets the prototype with its already saved items
+            if (receiver || task.m_receivers.empty())
             {
-                // prevent mail return
-                task.m_protoMail->SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+                // sending the prototype to an offline receiver deletes its items, write the batch before
+                if (task.m_receivers.empty())
+                {
+                    SendMailToOffline(task, offline);
+                    maxoffline -= std::min(maxoffline, uint32(offline.size()));
+                    offline.clear();
+                }
+
+                SendMailTo(task, receiver, receiver_guid);
 
                 if (!sendall)
                 {
                     --maxcount;
                 }
-                break;
+                continue;
             }
 
-            // need clone draft
-            MailDraft draft;
-            draft.CloneFrom(*task.m_protoMail);
-
-            // prevent mail return
-            draft.SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
-
-            if (!sendall)
-            {
-                --maxcount;
-            }
+            offline.push_back(receiver_lowguid);
         }
 
+        SendMailToOffline(task, offline);
+        maxoffline -= std::min(maxoffline, uint32(offline.size()));
+
         if (task.m_receivers.empty())
         {
+            sLog.outString("Mass mail: %u of %u mails sent, task finished", task.m_sent, task.m_total);
             m_massMails.pop_front();
         }
     }
-    while (!m_massMails.empty() && (sendall || maxcount > 0));
+    while (!m_massMails.empty() && (sendall || (maxcount > 0 && maxoffline > 0)));
+}
+
+void MassMailMgr::SendMailTo(MassMail& task, Player* receiver, ObjectGuid const& receiverGuid)
+{
+    ++task.m_sent;
+
+    // last case. can be just send
+    if (task.m_receivers.empty())
+    {
+        // prevent mail return
+        task.m_protoMail->SendMailTo(MailReceiver(receiver, receiverGuid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+        return;
+    }
+
+    // need clone draft
+    MailDraft draft;
+    draft.CloneFrom(*task.m_protoMail);
+
+    // prevent mail return
+    draft.SendMailTo(MailReceiver(receiver, receiverGuid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+}
+
+void MassMailMgr::SendMailToOffline(MassMail& task, std::vector<uint32> const& receivers)
+{
+    if (receivers.empty())
+    {
+        return;
+    }
+
+    // prevent mail return
+    task.m_protoMail->SendMailToOffline(receivers, task.m_sender, MAIL_CHECK_MASK_RETURNED);
+
+    uint32 lastPercent = task.m_total ? task.m_sent * 100 / task.m_total : 0;
+    task.m_sent += receivers.size();
+    uint32 percent = task.m_total ? task.m_sent * 100 / task.m_total : 0;
+
+    if (percent / 10 != lastPercent / 10)
+    {
+        sLog.outString("Mass mail: %u of %u mails sent (%u%%)", task.m_sent, task.m_total, percent);
+    }
 }
 
 void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) const
@@ -148,8 +197,8 @@ void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) c
 
     mails = mailsCount;
 
-    // 50 msecs is tick length
-    needTime = 50 * mailsCount / sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK) / IN_MILLISECONDS;
+    // 50 msecs is tick length, mostly offline receivers are written in batches
+    needTime = 50 * mailsCount / sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_OFFLINE_BATCH) / IN_MILLISECONDS;
 }
 
 
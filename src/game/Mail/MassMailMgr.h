@@ -48,6 +48,9 @@
 /**
  * A class to represent the mail send factory to multiple (often all existing) characters.
  *
+ * Online receivers get their mail one by one through MailDraft::SendMailTo, offline receivers
+ * are collected into batches written with MailDraft::SendMailToOffline.
+ *
  * Note: implementation not persistence for server shutdowns
  */
 class MassMailMgr
@@ -106,13 +109,13 @@ class MassMailMgr
         struct MassMail
         {
             explicit MassMail(MailDraft* mailProto, MailSender sender)
-                : m_protoMail(mailProto), m_sender(sender)
+                : m_protoMail(mailProto), m_sender(sender), m_total(0), m_sent(0)
             {
                 MANGOS_ASSERT(mailProto);
             }
 
             MassMail(MassMail const& massmail)
-                : m_protoMail(const_cast<MassMail&>(massmail).m_protoMail), m_sender(massmail.m_sender)
+                : m_protoMail(const_cast<MassMail&>(massmail).m_protoMail), m_sender(massmail.m_sender), m_total(0), m_sent(0)
             {
             }
 
@@ -121,10 +124,19 @@ class MassMailMgr
 
             MailSender m_sender;
             ReceiversList m_receivers;
+
+            uint32 m_total;                                 ///< receivers count when the task started, for progress reports
+            uint32 m_sent;
         };
 
         typedef std::list<MassMail> MassMailList;
 
+        /// Sends the mail to one receiver the direct way, the last receiver of a task gets the prototype itself
+        void SendMailTo(MassMail& task, Player* receiver, ObjectGuid const& receiverGuid);
+
+        /// Writes the mail for a batch of offline receivers and reports the task progress
+        void SendMailToOffline(MassMail& task, std::vector<uint32> const& receivers);
+
         /// List of current queued mass mail tasks
         MassMailList m_massMails;
 };
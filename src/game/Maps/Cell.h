@@ -123,6 +123,10 @@ struct Cell
         template<class T> static void VisitWorldObjects(float x, float y, Map* map, T& visitor, float radius, bool dont_load = true);
         template<class T> static void VisitAllObjects(float x, float y, Map* map, T& visitor, float radius, bool dont_load = true);
 
+        // Walks the flat per-cell object index instead of the type containers; func is called with WorldObject*
+        // for every object of typeMask whose (index flags & flagsMask) == flags and whose bounds may reach radius.
+        template<class F> static void VisitIndexedObjects(const WorldObject* obj, F& func, float radius, uint32 typeMask, uint32 flagsMask, uint32 flags, bool dont_load = true);
+
     private:
         template<class T, class CONTAINER> void VisitCircle(TypeContainerVisitor<T, CONTAINER> &, Map&, const CellPair& , const CellPair&) const;
 };
@@ -265,4 +265,46 @@ inline void Cell::VisitAllObjects(float x, float y, Map* map, T& visitor, float
     cell.Visit(p, wnotifier, *map, x, y, radius);
 }
 
+namespace MaNGOS
+{
+    template<class F>
+    struct IndexedObjectCaller
+    {
+        F& i_func;
+        explicit IndexedObjectCaller(F& func) : i_func(func) {}
+        void operator()(void* obj) { i_func(static_cast<WorldObject*>(obj)); }
+    };
+}
+
+template<class F>
+inline void Cell::VisitIndexedObjects(const WorldObject* center_obj, F& func, float radius, uint32 typeMask, uint32 flagsMask, uint32 flags, bool dont_load)
+{
+    const float x = center_obj->GetPositionX();
+    const float y = center_obj->GetPositionY();
+    Map& map = *center_obj->GetMap();
+
+    radius += center_obj->GetObjectBoundingRadius();
+    // same upper limit as Cell::Visit
+    if (radius > 333.0f)
+    {
+        radius = 333.0f;
+    }
+
+    MaNGOS::IndexedObjectCaller<F> caller(func);
+    CellArea area = Cell::CalculateCellArea(x, y, radius);
+    for (uint32 loopX = area.low_bound.x_coord; loopX <= area.high_bound.x_coord; ++loopX)
+    {
+        for (uint32 loopY = area.low_bound.y_coord; loopY <= area.high_bound.y_coord; ++loopY)
+        {
+            CellPair cell_pair(loopX, loopY);
+            Cell r_zone(cell_pair);
+            if (dont_load)
+            {
+                r_zone.SetNoCreate();
+            }
+            map.VisitObjectIndex(r_zone, x, y, radius, typeMask, flagsMask, flags, caller);
+        }
+    }
+}
+
 #endif
@@ -100,7 +100,7 @@ void VisibleNotifier::Notify()
     // Now do operations that required done at object visibility change to visible
 
     // send data at target visibility change (adding to client)
-    for (std::set<WorldObject*>::const_iterator vItr = i_visibleNow.begin(); vItr != i_visibleNow.end(); ++vItr)
+    for (VisibleObjectSet::const_iterator vItr = i_visibleNow.begin(); vItr != i_visibleNow.end(); ++vItr)
     {
         // target aura duration for caster show only if target exist at caster client
         if ((*vItr) != &player && (*vItr)->isType(TYPEMASK_UNIT))
@@ -110,6 +110,48 @@ void VisibleNotifier::Notify()
     }
 }
 
+void VisibleChangesBatchNotifier::Visit(CameraMapType& m)
+{
+    for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Camera* camera = iter->getSource();
+        if (i_skipped.find(camera->GetBody()) != i_skipped.end())
+        {
+            continue;
+        }
+
+        CameraBatch& batch = i_batches[camera];
+        camera->UpdateVisibilityOf(i_object, batch.i_data, batch.i_visibleNow);
+    }
+}
+
+void VisibleChangesBatchNotifier::Notify()
+{
+    for (BatchMap::iterator itr = i_batches.begin(); itr != i_batches.end(); ++itr)
+    {
+        Player& player = *itr->first->GetOwner();
+        CameraBatch& batch = itr->second;
+
+        if (batch.i_data.HasData())
+        {
+            WorldPacket packet;
+            batch.i_data.BuildPacket(&packet);
+            player.GetSession()->SendPacket(&packet);
+        }
+
+        // target aura duration for caster show only if target exist at caster client
+        for (VisibleObjectSet::const_iterator vItr = batch.i_visibleNow.begin(); vItr != batch.i_visibleNow.end(); ++vItr)
+        {
+            if ((*vItr) != &player && (*vItr)->isType(TYPEMASK_UNIT))
+            {
+                player.SendAuraDurationsForTarget((Unit*)(*vItr));
+            }
+        }
+    }
+
+    i_batches.clear();
+}
+
 void MessageDeliverer::Visit(CameraMapType& m)
 {
     for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -144,6 +186,41 @@ void MessageDelivererExcept::Visit(CameraMapType& m)
     }
 }
 
+void MovementRelayDeliverer::Visit(CameraMapType& m)
+{
+    for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Camera* camera = iter->getSource();
+        Player* owner = camera->GetOwner();
+
+        if (owner->GetObjectGuid() == i_skipped)
+        {
+            continue;
+        }
+
+        if (i_nearDistSq > 0.0f)
+        {
+            float dx = camera->GetBody()->GetPositionX() - i_mover.GetPositionX();
+            float dy = camera->GetBody()->GetPositionY() - i_mover.GetPositionY();
+            float distSq = dx * dx + dy * dy;
+            uint32 stride = distSq <= i_nearDistSq ? 1 : (distSq <= 4 * i_nearDistSq ? 2 : 4);
+
+            // spread thinned heartbeats of one mover over observers
+            if ((i_sequence + owner->GetGUIDLow()) % stride)
+            {
+                ++i_thinned;
+                continue;
+            }
+        }
+
+        if (WorldSession* session = owner->GetSession())
+        {
+            session->SendPacket(i_message);
+            ++i_sent;
+        }
+    }
+}
+
 void ObjectMessageDeliverer::Visit(CameraMapType& m)
 {
     for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -41,7 +41,7 @@ namespace MaNGOS
         Camera& i_camera;
         UpdateData i_data;
         GuidSet i_clientGUIDs;
-        std::set<WorldObject*> i_visibleNow;
+        VisibleObjectSet i_visibleNow;
 
         explicit VisibleNotifier(Camera& c) : i_camera(c), i_clientGUIDs(c.GetOwner()->m_clientGUIDs) {}
         template<class T> void Visit(GridRefManager<T>& m);
@@ -58,6 +58,30 @@ namespace MaNGOS
         void Visit(CameraMapType&);
     };
 
+    // Collects visibility changes of several relocated objects and sends them as one update packet per camera.
+    // Cameras which body is in i_skipped already rebuilt their whole view this tick and are not visited again.
+    struct VisibleChangesBatchNotifier
+    {
+        struct CameraBatch
+        {
+            UpdateData i_data;
+            VisibleObjectSet i_visibleNow;
+        };
+
+        typedef std::set<WorldObject const*, std::less<WorldObject const*>, TickAllocator<WorldObject const*> > SkippedSet;
+        typedef std::map<Camera*, CameraBatch, std::less<Camera*>, TickAllocator<std::pair<Camera* const, CameraBatch> > > BatchMap;
+
+        SkippedSet const& i_skipped;
+        BatchMap i_batches;
+        WorldObject* i_object;
+
+        explicit VisibleChangesBatchNotifier(SkippedSet const& skipped) : i_skipped(skipped), i_object(NULL) {}
+        void SetObject(WorldObject* object) { i_object = object; }
+        template<class T> void Visit(GridRefManager<T>&) {}
+        void Visit(CameraMapType&);
+        void Notify(void);
+    };
+
     struct MessageDeliverer
     {
         Player const& i_player;
@@ -80,6 +104,24 @@ namespace MaNGOS
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
     };
 
+    // Sends movement heartbeat of i_mover, to observers beyond near distance (if any) only every second or fourth one
+    struct MovementRelayDeliverer
+    {
+        WorldObject const& i_mover;
+        WorldPacket* i_message;
+        ObjectGuid i_skipped;
+        uint32 i_sequence;
+        float i_nearDistSq;
+        uint32 i_sent;
+        uint32 i_thinned;
+
+        MovementRelayDeliverer(WorldObject const& mover, WorldPacket* msg, ObjectGuid skipped, uint32 sequence, float nearDist)
+            : i_mover(mover), i_message(msg), i_skipped(skipped), i_sequence(sequence), i_nearDistSq(nearDist * nearDist), i_sent(0), i_thinned(0) {}
+
+        void Visit(CameraMapType& m);
+        template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+    };
+
     struct ObjectMessageDeliverer
     {
         WorldPacket* i_message;
@@ -378,13 +420,13 @@ namespace MaNGOS
     };
 
     // All accepted by Check units if any
-    template<class Check>
+    template<class Check, class List = std::list<Unit*> >
     struct UnitListSearcher
     {
-        std::list<Unit*>& i_objects;
+        List& i_objects;
         Check& i_check;
 
-        UnitListSearcher(std::list<Unit*>& objects, Check& check) : i_objects(objects), i_check(check) {}
+        UnitListSearcher(List& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
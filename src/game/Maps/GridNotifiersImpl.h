@@ -573,8 +573,8 @@ void MaNGOS::UnitLastSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
-template<class Check>
-void MaNGOS::UnitListSearcher<Check>::Visit(PlayerMapType& m)
+template<class Check, class List>
+void MaNGOS::UnitListSearcher<Check, List>::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -583,8 +583,8 @@ void MaNGOS::UnitListSearcher<Check>::Visit(PlayerMapType& m)
         }
 }
 
-template<class Check>
-void MaNGOS::UnitListSearcher<Check>::Visit(CreatureMapType& m)
+template<class Check, class List>
+void MaNGOS::UnitListSearcher<Check, List>::Visit(CreatureMapType& m)
 {
     for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
         if (i_check(itr->getSource()))
@@ -29,6 +29,45 @@
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
 
+namespace
+{
+    // Adapters for Cell::VisitIndexedObjects: the index only prefilters by type and 2D bounds,
+    // the exact range and entry tests are still done by the usual Check objects.
+    template<class T, class Check>
+    struct IndexedLastSearcher
+    {
+        T*& i_object;
+        Check& i_check;
+
+        IndexedLastSearcher(T*& result, Check& check) : i_object(result), i_check(check) {}
+
+        void operator()(WorldObject* obj)
+        {
+            if (i_check(static_cast<T*>(obj)))
+            {
+                i_object = static_cast<T*>(obj);
+            }
+        }
+    };
+
+    template<class T, class Check>
+    struct IndexedListSearcher
+    {
+        std::list<T*>& i_objects;
+        Check& i_check;
+
+        IndexedListSearcher(std::list<T*>& objects, Check& check) : i_objects(objects), i_check(check) {}
+
+        void operator()(WorldObject* obj)
+        {
+            if (i_check(static_cast<T*>(obj)))
+            {
+                i_objects.push_back(static_cast<T*>(obj));
+            }
+        }
+    };
+}
+
 /**
  * @brief Returns the closest GameObject with a specific entry within a given range.
  * 
@@ -44,9 +83,9 @@ GameObject* GetClosestGameObjectWithEntry(WorldObject* pSource, uint32 uiEntry,
     GameObject* pGo = nullptr;
 
     MaNGOS::NearestGameObjectEntryInObjectRangeCheck go_check(*pSource, uiEntry, fMaxSearchRange);
-    MaNGOS::GameObjectLastSearcher<MaNGOS::NearestGameObjectEntryInObjectRangeCheck> searcher(pGo, go_check);
+    IndexedLastSearcher<GameObject, MaNGOS::NearestGameObjectEntryInObjectRangeCheck> searcher(pGo, go_check);
 
-    Cell::VisitGridObjects(pSource, searcher, fMaxSearchRange);
+    Cell::VisitIndexedObjects(pSource, searcher, fMaxSearchRange, TYPEMASK_GAMEOBJECT, GRID_INDEX_FLAG_WORLD_CONTAINER, 0);
 
     return pGo;
 }
@@ -69,9 +108,10 @@ Creature* GetClosestCreatureWithEntry(WorldObject* pSource, uint32 uiEntry, floa
     Creature* pCreature = nullptr;
 
     MaNGOS::NearestCreatureEntryWithLiveStateInObjectRangeCheck creature_check(*pSource, uiEntry, bOnlyAlive, bOnlyDead, fMaxSearchRange, bExcludeSelf);
-    MaNGOS::CreatureLastSearcher<MaNGOS::NearestCreatureEntryWithLiveStateInObjectRangeCheck> searcher(pCreature, creature_check);
+    IndexedLastSearcher<Creature, MaNGOS::NearestCreatureEntryWithLiveStateInObjectRangeCheck> searcher(pCreature, creature_check);
 
-    Cell::VisitGridObjects(pSource, searcher, fMaxSearchRange);
+    // grid container creatures only, pets and players live in the world container
+    Cell::VisitIndexedObjects(pSource, searcher, fMaxSearchRange, TYPEMASK_UNIT, GRID_INDEX_FLAG_WORLD_CONTAINER, 0);
 
     return pCreature;
 }
@@ -89,9 +129,9 @@ Creature* GetClosestCreatureWithEntry(WorldObject* pSource, uint32 uiEntry, floa
 void GetGameObjectListWithEntryInGrid(std::list<GameObject*>& lList , WorldObject* pSource, uint32 uiEntry, float fMaxSearchRange)
 {
     MaNGOS::GameObjectEntryInPosRangeCheck check(*pSource, uiEntry, pSource->GetPositionX(), pSource->GetPositionY(), pSource->GetPositionZ(), fMaxSearchRange);
-    MaNGOS::GameObjectListSearcher<MaNGOS::GameObjectEntryInPosRangeCheck> searcher(lList, check);
+    IndexedListSearcher<GameObject, MaNGOS::GameObjectEntryInPosRangeCheck> searcher(lList, check);
 
-    Cell::VisitGridObjects(pSource, searcher, fMaxSearchRange);
+    Cell::VisitIndexedObjects(pSource, searcher, fMaxSearchRange, TYPEMASK_GAMEOBJECT, GRID_INDEX_FLAG_WORLD_CONTAINER, 0);
 }
 
 /**
@@ -107,7 +147,7 @@ void GetGameObjectListWithEntryInGrid(std::list<GameObject*>& lList , WorldObjec
 void GetCreatureListWithEntryInGrid(std::list<Creature*>& lList, WorldObject* pSource, uint32 uiEntry, float fMaxSearchRange)
 {
     MaNGOS::AllCreaturesOfEntryInRangeCheck check(pSource, uiEntry, fMaxSearchRange);
-    MaNGOS::CreatureListSearcher<MaNGOS::AllCreaturesOfEntryInRangeCheck> searcher(lList, check);
+    IndexedListSearcher<Creature, MaNGOS::AllCreaturesOfEntryInRangeCheck> searcher(lList, check);
 
-    Cell::VisitGridObjects(pSource, searcher, fMaxSearchRange);
+    Cell::VisitIndexedObjects(pSource, searcher, fMaxSearchRange, TYPEMASK_UNIT, GRID_INDEX_FLAG_WORLD_CONTAINER, 0);
 }
@@ -44,6 +44,9 @@
 #include "Weather.h"
 #include "Transports.h"
 #include "ObjectGridLoader.h"
+#include "TickProfiler.h"
+#include "GameEventMgr.h"
+#include "GameTime.h"
 
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
@@ -121,10 +124,10 @@ void Map::LoadMapAndVMap(int gx, int gy)
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
     : i_mapEntry(sMapStore.LookupEntry(id)),
       i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
-      m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_persistentState(NULL),
+      m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_InterestDistance(0.0f), m_persistentState(NULL),
       m_activeNonPlayersIter(m_activeNonPlayers.end()),
       i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
-      i_data(NULL)
+      i_data(NULL), m_movementRelay(*this)
 {
 #ifdef ENABLE_ELUNA
     // lua state begins uninitialized
@@ -172,49 +175,62 @@ void Map::InitVisibilityDistance()
 {
     // init visibility for continents
     m_VisibleDistance = World::GetMaxVisibleDistanceOnContinents();
+    m_InterestDistance = World::GetInterestDistanceOnContinents();
 }
 
 // Template specialization of utility methods
 template<class T>
 void Map::AddToGrid(T* obj, NGridType* grid, Cell const& cell)
 {
-    (*grid)(cell.CellX(), cell.CellY()).template AddGridObject<T>(obj);
+    GridType& gridCell = (*grid)(cell.CellX(), cell.CellY());
+    gridCell.template AddGridObject<T>(obj);
+    obj->AddToObjectIndex(gridCell.GetObjectIndex(), 0);
 }
 
 template<>
 void Map::AddToGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
-    (*grid)(cell.CellX(), cell.CellY()).AddWorldObject(obj);
+    GridType& gridCell = (*grid)(cell.CellX(), cell.CellY());
+    gridCell.AddWorldObject(obj);
+    obj->AddToObjectIndex(gridCell.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
 }
 
 template<>
 void Map::AddToGrid(Corpse* obj, NGridType* grid, Cell const& cell)
 {
+    GridType& gridCell = (*grid)(cell.CellX(), cell.CellY());
+
     // add to world object registry in grid
     if (obj->GetType() != CORPSE_BONES)
     {
-        (*grid)(cell.CellX(), cell.CellY()).AddWorldObject(obj);
+        gridCell.AddWorldObject(obj);
+        obj->AddToObjectIndex(gridCell.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
     }
     // add to grid object store
     else
     {
-        (*grid)(cell.CellX(), cell.CellY()).AddGridObject(obj);
+        gridCell.AddGridObject(obj);
+        obj->AddToObjectIndex(gridCell.GetObjectIndex(), 0);
     }
 }
 
 template<>
 void Map::AddToGrid(Creature* obj, NGridType* grid, Cell const& cell)
 {
+    GridType& gridCell = (*grid)(cell.CellX(), cell.CellY());
+
     // add to world object registry in grid
     if (obj->IsPet())
     {
-        (*grid)(cell.CellX(), cell.CellY()).AddWorldObject<Creature>(obj);
+        gridCell.AddWorldObject<Creature>(obj);
+        obj->AddToObjectIndex(gridCell.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
         obj->SetCurrentCell(cell);
     }
     // add to grid object store
     else
     {
-        (*grid)(cell.CellX(), cell.CellY()).AddGridObject<Creature>(obj);
+        gridCell.AddGridObject<Creature>(obj);
+        obj->AddToObjectIndex(gridCell.GetObjectIndex(), 0);
         obj->SetCurrentCell(cell);
     }
 }
@@ -223,12 +239,14 @@ template<class T>
 void Map::RemoveFromGrid(T* obj, NGridType* grid, Cell const& cell)
 {
     (*grid)(cell.CellX(), cell.CellY()).template RemoveGridObject<T>(obj);
+    obj->RemoveFromObjectIndex();
 }
 
 template<>
 void Map::RemoveFromGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
     (*grid)(cell.CellX(), cell.CellY()).RemoveWorldObject(obj);
+    obj->RemoveFromObjectIndex();
 }
 
 template<>
@@ -244,6 +262,7 @@ void Map::RemoveFromGrid(Corpse* obj, NGridType* grid, Cell const& cell)
     {
         (*grid)(cell.CellX(), cell.CellY()).RemoveGridObject(obj);
     }
+    obj->RemoveFromObjectIndex();
 }
 
 template<>
@@ -259,6 +278,7 @@ void Map::RemoveFromGrid(Creature* obj, NGridType* grid, Cell const& cell)
     {
         (*grid)(cell.CellX(), cell.CellY()).RemoveGridObject<Creature>(obj);
     }
+    obj->RemoveFromObjectIndex();
 }
 
 void Map::DeleteFromWorld(Player* pl)
@@ -570,9 +590,15 @@ void Map::VisitNearbyCellsOf(WorldObject* obj,
 
 void Map::Update(const uint32& t_diff)
 {
+    // transient containers of this update take their memory from the map arena
+    MaNGOS::TickArena::Scope tickArena(m_tickArena);
+
+    TickPhaseTimer phaseTimer;
+
     m_dyn_tree.update(t_diff);
 
     /// update worldsessions for existing players
+    phaseTimer.Start(TICK_PHASE_MAP_SESSIONS);
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* plr = m_mapRefIter->getSource();
@@ -585,7 +611,11 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
+    /// send movement heartbeats held by the relay
+    m_movementRelay.Update();
+
     /// update players at tick
+    phaseTimer.Start(TICK_PHASE_MAP_PLAYERS);
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* plr = m_mapRefIter->getSource();
@@ -604,6 +634,7 @@ void Map::Update(const uint32& t_diff)
     }
 
     /// update active cells around players and active objects
+    phaseTimer.Start(TICK_PHASE_MAP_CELLS);
     resetMarkedCells();
 
     MaNGOS::ObjectUpdater updater(t_diff);
@@ -629,7 +660,7 @@ void Map::Update(const uint32& t_diff)
         // Combat state will change on next tick, if case
         if (!IsDungeon() && plr->IsInCombat())
         {
-            std::vector<Creature*> _removeList;
+            std::vector<Creature*, MaNGOS::TickAllocator<Creature*> > _removeList;
             HostileRefManager& href = plr->GetHostileRefManager();
             HostileReference* ref = href.getFirst();
 
@@ -644,7 +675,7 @@ void Map::Update(const uint32& t_diff)
                 ref = ref->next();
             }
 
-            for (std::vector<Creature*>::iterator it = _removeList.begin(); it != _removeList.end(); ++it)
+            for (std::vector<Creature*, MaNGOS::TickAllocator<Creature*> >::iterator it = _removeList.begin(); it != _removeList.end(); ++it)
             {
                 (*it)->RemoveAurasByCaster(plr->GetObjectGuid());
                 (*it)->_removeAttacker(plr);
@@ -678,9 +709,16 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
+    // Recalculate visibility of units relocated since last tick
+    phaseTimer.Start(TICK_PHASE_MAP_VISIBILITY);
+    ProcessVisibilityUpdates();
+
     // Send world objects and item update field changes
+    phaseTimer.Start(TICK_PHASE_MAP_OBJECT_UPDATES);
     SendObjectUpdates();
 
+    phaseTimer.Start(TICK_PHASE_MAP_GRIDS);
+
     // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattleGround())
@@ -696,12 +734,16 @@ void Map::Update(const uint32& t_diff)
     }
 
     ///- Process necessary scripts
+    phaseTimer.Start(TICK_PHASE_MAP_SCRIPTS);
     if (!m_scriptSchedule.empty())
     {
         ScriptsProcess();
     }
 
+    ProcessGameEventJobs();
+
 #ifdef ENABLE_ELUNA
+    phaseTimer.Start(TICK_PHASE_MAP_ELUNA);
     if (Eluna* e = GetEluna())
     {
         if (!sElunaConfig->IsElunaCompatibilityMode())
@@ -713,12 +755,124 @@ void Map::Update(const uint32& t_diff)
     }
 #endif /* ENABLE_ELUNA */
 
+    phaseTimer.Start(TICK_PHASE_MAP_INSTANCE);
     if (i_data)
     {
         i_data->Update(t_diff);
     }
 
     m_weatherSystem->UpdateWeathers(t_diff);
+
+    m_persistentState->UpdateRespawnTimes(t_diff);
+}
+
+void Map::AddGameEventJob(GameEventSpawnJob const& job)
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_gameEventJobsLock);
+    m_gameEventJobs.push_back(job);
+}
+
+void Map::ProcessGameEventJobs()
+{
+    uint32 limit = sWorld.getConfig(CONFIG_UINT32_GAME_EVENT_SPAWNS_PER_MAP_UPDATE);
+
+    std::vector<GameEventSpawnJob> jobs;
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, m_gameEventJobsLock);
+        if (m_gameEventJobs.empty())
+        {
+            return;
+        }
+
+        size_t count = limit ? std::min<size_t>(limit, m_gameEventJobs.size()) : m_gameEventJobs.size();
+        jobs.assign(m_gameEventJobs.begin(), m_gameEventJobs.begin() + count);
+        m_gameEventJobs.erase(m_gameEventJobs.begin(), m_gameEventJobs.begin() + count);
+    }
+
+    for (std::vector<GameEventSpawnJob>::const_iterator itr = jobs.begin(); itr != jobs.end(); ++itr)
+    {
+        ExecuteGameEventJob(*itr);
+    }
+}
+
+void Map::ExecuteGameEventJob(GameEventSpawnJob const& job)
+{
+    switch (job.type)
+    {
+        case GAME_EVENT_JOB_SPAWN_CREATURE:
+        {
+            CreatureData const* data = sObjectMgr.GetCreatureData(job.dbGuid);
+            // grid may have been loaded with the spawn since the job was queued
+            if (data && IsLoaded(data->posX, data->posY) && !GetCreature(data->GetObjectGuid(job.dbGuid)))
+            {
+                Creature* pCreature = new Creature;
+                if (!pCreature->LoadFromDB(job.dbGuid, this))
+                {
+                    delete pCreature;
+                }
+            }
+            break;
+        }
+        case GAME_EVENT_JOB_DESPAWN_CREATURE:
+        {
+            if (CreatureData const* data = sObjectMgr.GetCreatureData(job.dbGuid))
+            {
+                if (Creature* pCreature = GetCreature(data->GetObjectGuid(job.dbGuid)))
+                {
+                    pCreature->AddObjectToRemoveList();
+                }
+            }
+            break;
+        }
+        case GAME_EVENT_JOB_SPAWN_GAMEOBJECT:
+        {
+            GameObjectData const* data = sObjectMgr.GetGOData(job.dbGuid);
+            if (data && IsLoaded(data->posX, data->posY) && !GetGameObject(ObjectGuid(HIGHGUID_GAMEOBJECT, data->id, job.dbGuid)))
+            {
+                GameObject* pGameobject = new GameObject;
+                if (!pGameobject->LoadFromDB(job.dbGuid, this))
+                {
+                    delete pGameobject;
+                }
+                else if (pGameobject->isSpawnedByDefault())
+                {
+                    Add(pGameobject);
+                }
+            }
+            break;
+        }
+        case GAME_EVENT_JOB_DESPAWN_GAMEOBJECT:
+        {
+            if (GameObjectData const* data = sObjectMgr.GetGOData(job.dbGuid))
+            {
+                if (GameObject* pGameobject = GetGameObject(ObjectGuid(HIGHGUID_GAMEOBJECT, data->id, job.dbGuid)))
+                {
+                    pGameobject->AddObjectToRemoveList();
+                }
+            }
+            break;
+        }
+        case GAME_EVENT_JOB_UPDATE_CREATURE:
+        {
+            CreatureData const* data = sObjectMgr.GetCreatureData(job.dbGuid);
+            if (!data)
+            {
+                break;
+            }
+
+            if (Creature* pCreature = GetCreature(data->GetObjectGuid(job.dbGuid)))
+            {
+                pCreature->UpdateEntry(data->id, TEAM_NONE, data, job.activate ? job.eventData : NULL);
+
+                // spells not casted for event remove case (sent NULL into update), do it
+                if (!job.activate)
+                {
+                    pCreature->ApplyGameEventSpells(job.eventData, false);
+                }
+            }
+            break;
+        }
+    }
 }
 
 void Map::Remove(Player* player, bool remove)
@@ -1051,6 +1205,56 @@ void Map::UpdateObjectVisibility(WorldObject* obj, Cell cell, CellPair cellpair)
     cell.Visit(cellpair, player_notifier, *this, *obj, GetVisibilityDistance());
 }
 
+void Map::AddVisibilityUpdate(Unit* unit)
+{
+    m_visibilityUpdates.insert(unit->GetObjectGuid());
+}
+
+void Map::ProcessVisibilityUpdates()
+{
+    if (m_visibilityUpdates.empty())
+    {
+        return;
+    }
+
+    // units could leave the map or be removed since they were queued
+    std::vector<Unit*, MaNGOS::TickAllocator<Unit*> > units;
+    MaNGOS::VisibleChangesBatchNotifier::SkippedSet refreshed;
+    units.reserve(m_visibilityUpdates.size());
+    for (GuidSet::const_iterator itr = m_visibilityUpdates.begin(); itr != m_visibilityUpdates.end(); ++itr)
+    {
+        Unit* unit = GetUnit(*itr);
+        if (unit && unit->IsInWorld() && unit->GetMap() == this)
+        {
+            units.push_back(unit);
+            refreshed.insert(unit);
+        }
+    }
+    m_visibilityUpdates.clear();
+
+    // first rebuild the whole view of cameras attached to relocated units,
+    // this already covers every pair where the observer itself was relocated
+    for (std::vector<Unit*, MaNGOS::TickAllocator<Unit*> >::const_iterator itr = units.begin(); itr != units.end(); ++itr)
+    {
+        (*itr)->GetViewPoint().Call_UpdateVisibilityForOwner();
+    }
+
+    // then update the remaining observers, gathering all their changes into one packet
+    MaNGOS::VisibleChangesBatchNotifier notifier(refreshed);
+    TypeContainerVisitor<MaNGOS::VisibleChangesBatchNotifier, WorldTypeMapContainer > player_notifier(notifier);
+    for (std::vector<Unit*, MaNGOS::TickAllocator<Unit*> >::const_iterator itr = units.begin(); itr != units.end(); ++itr)
+    {
+        Unit* unit = *itr;
+        CellPair p = MaNGOS::ComputeCellPair(unit->GetPositionX(), unit->GetPositionY());
+        Cell cell(p);
+        cell.SetNoCreate();
+
+        notifier.SetObject(unit);
+        cell.Visit(p, player_notifier, *this, *unit, GetVisibilityDistance());
+    }
+    notifier.Notify();
+}
+
 void Map::SendInitSelf(Player* player)
 {
     DETAIL_LOG("Creating player data for himself %u", player->GetGUIDLow());
@@ -1553,6 +1757,7 @@ void DungeonMap::InitVisibilityDistance()
 {
     // init visibility distance for instances
     m_VisibleDistance = World::GetMaxVisibleDistanceInInstances();
+    m_InterestDistance = World::GetInterestDistanceInInstances();
 }
 
 /*
@@ -1852,6 +2057,7 @@ void BattleGroundMap::InitVisibilityDistance()
 {
     // init visibility distance for BG/Arenas
     m_VisibleDistance = World::GetMaxVisibleDistanceInBGArenas();
+    m_InterestDistance = World::GetInterestDistanceInBGArenas();
 }
 
 bool BattleGroundMap::CanEnter(Player* player)
@@ -2164,6 +2370,29 @@ void Map::SendObjectUpdates()
 {
     UpdateDataMapType update_players;
 
+    // units without new changes still have to send held back ones to far observers
+    if (!m_farUpdateObjects.empty())
+    {
+        uint32 now = GameTime::GetGameTimeMS();
+        for (GuidSet::iterator itr = m_farUpdateObjects.begin(); itr != m_farUpdateObjects.end();)
+        {
+            Unit* unit = GetUnit(*itr);
+            if (!unit || !unit->IsInWorld() || !unit->HasFarUpdatePending())
+            {
+                m_farUpdateObjects.erase(itr++);
+            }
+            else if (unit->IsFarUpdateDue(now))
+            {
+                unit->MarkForClientUpdate();
+                m_farUpdateObjects.erase(itr++);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+
     while (!i_objectsToClientUpdate.empty())
     {
         Object* obj = *i_objectsToClientUpdate.begin();
@@ -42,13 +42,16 @@
 #include "ScriptMgr.h"
 #include "CreatureLinkingMgr.h"
 #include "DynamicTree.h"
+#include "MovementRelay.h"
 #ifdef ENABLE_ELUNA
 #include "LuaValue.h"
 #endif /* ENABLE_ELUNA */
 
 #include <bitset>
+#include <deque>
 
 struct CreatureInfo;
+struct GameEventCreatureData;
 class Creature;
 #ifdef ENABLE_ELUNA
 class Eluna;
@@ -100,6 +103,27 @@ struct InstanceTemplate
 
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 
+enum GameEventSpawnJobType
+{
+    GAME_EVENT_JOB_SPAWN_CREATURE,
+    GAME_EVENT_JOB_DESPAWN_CREATURE,
+    GAME_EVENT_JOB_SPAWN_GAMEOBJECT,
+    GAME_EVENT_JOB_DESPAWN_GAMEOBJECT,
+    GAME_EVENT_JOB_UPDATE_CREATURE
+};
+
+// Spawn change of a starting or stopping game event, applied by the map during its own update
+struct GameEventSpawnJob
+{
+    GameEventSpawnJob(GameEventSpawnJobType _type, uint32 _dbGuid, GameEventCreatureData const* _eventData = NULL, bool _activate = false)
+        : type(_type), dbGuid(_dbGuid), eventData(_eventData), activate(_activate) {}
+
+    GameEventSpawnJobType type;
+    uint32 dbGuid;
+    GameEventCreatureData const* eventData;                 // GAME_EVENT_JOB_UPDATE_CREATURE only
+    bool activate;
+};
+
 class Map : public GridRefManager<NGridType>
 {
         friend class MapReference;
@@ -142,6 +166,8 @@ class Map : public GridRefManager<NGridType>
         void MessageDistBroadcast(WorldObject const*, WorldPacket*, float dist);
 
         float GetVisibilityDistance() const { return m_VisibleDistance; }
+        // observers beyond get value and movement updates at reduced rate, 0 if all are updated in real time
+        float GetInterestDistance() const { return m_InterestDistance; }
         // function for setting up visibility distance for maps on per-type/per-Id basis
         virtual void InitVisibilityDistance();
 
@@ -149,6 +175,7 @@ class Map : public GridRefManager<NGridType>
         void CreatureRelocation(Creature* creature, float x, float y, float z, float orientation);
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
+        template<class F> void VisitObjectIndex(const Cell& cell, float x, float y, float radius, uint32 typeMask, uint32 flagsMask, uint32 flags, F& func);
 
         bool IsRemovalGrid(float x, float y) const
         {
@@ -201,6 +228,12 @@ class Map : public GridRefManager<NGridType>
         void AddObjectToRemoveList(WorldObject* obj);
 
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, CellPair cellpair);
+        // visibility of the unit will be recalculated together with other relocated units at map tick
+        void AddVisibilityUpdate(Unit* unit);
+
+        MovementRelay& GetMovementRelay() { return m_movementRelay; }
+        // unit will be updated again for far observers when its interest update interval ends
+        void AddFarUpdateObject(WorldObject* obj) { m_farUpdateObjects.insert(obj->GetObjectGuid()); }
 
         void resetMarkedCells() { marked_cells.reset(); }
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
@@ -306,6 +339,9 @@ class Map : public GridRefManager<NGridType>
 
         void LoadLocalTransports();
 
+        // Game event spawns, applied in batches of GameEvent.SpawnsPerMapUpdate
+        void AddGameEventJob(GameEventSpawnJob const& job);
+
 #ifdef ENABLE_ELUNA
         Eluna* GetEluna() const;
 
@@ -347,16 +383,24 @@ class Map : public GridRefManager<NGridType>
 
         void setNGrid(NGridType* grid, uint32 x, uint32 y);
         void ScriptsProcess();
+        void ProcessGameEventJobs();
+        void ExecuteGameEventJob(GameEventSpawnJob const& job);
 
         void SendObjectUpdates();
         std::set<Object*> i_objectsToClientUpdate;
 
+        void ProcessVisibilityUpdates();
+        GuidSet m_visibilityUpdates;
+
+        GuidSet m_farUpdateObjects;                         // units holding back value changes from far observers
+
     protected:
         MapEntry const* i_mapEntry;
         uint32 i_id;
         uint32 i_InstanceId;
         uint32 m_unloadTimer;
         float m_VisibleDistance;
+        float m_InterestDistance;
         MapPersistentState* m_persistentState;
 
         MapRefManager m_mapRefManager;
@@ -386,6 +430,9 @@ class Map : public GridRefManager<NGridType>
 
         InstanceData* i_data;
 
+        std::deque<GameEventSpawnJob> m_gameEventJobs;
+        ACE_Thread_Mutex m_gameEventJobsLock;
+
         // Map local low guid counters
         ObjectGuidGenerator<HIGHGUID_UNIT> m_CreatureGuids;
         ObjectGuidGenerator<HIGHGUID_GAMEOBJECT> m_GameObjectGuids;
@@ -404,6 +451,12 @@ class Map : public GridRefManager<NGridType>
         // Dynamic Map tree object
         DynamicMapTree m_dyn_tree;
 
+        // Pending movement heartbeats of players on the map
+        MovementRelay m_movementRelay;
+
+        // Temporary memory of the current update, reset at the end of Map::Update
+        MaNGOS::TickArena m_tickArena;
+
         // WeatherSystem
         WeatherSystem* m_weatherSystem;
 
@@ -495,4 +548,18 @@ Map::Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor)
         getNGrid(x, y)->Visit(cell_x, cell_y, visitor);
     }
 }
+
+template<class F>
+inline void
+Map::VisitObjectIndex(const Cell& cell, float x, float y, float radius, uint32 typeMask, uint32 flagsMask, uint32 flags, F& func)
+{
+    const uint32 gx = cell.GridX();
+    const uint32 gy = cell.GridY();
+
+    if (!cell.NoCreate() || loaded(GridPair(gx, gy)))
+    {
+        EnsureGridLoaded(cell);
+        (*getNGrid(gx, gy))(cell.CellX(), cell.CellY()).GetObjectIndex().Visit(x, y, radius, typeMask, flagsMask, flags, func);
+    }
+}
 #endif
@@ -68,7 +68,7 @@ MapManager::Initialize()
     int num_threads(sWorld.getConfig(CONFIG_UINT32_NUMTHREADS));
 
 #ifdef ENABLE_ELUNA
-    if (sElunaConfig->IsElunaEnabled() && sElunaConfig->IsElunaCompatibilityMode() && num_threads > 1)
+    if (sElunaConfig->IsElunaEnabled() && sElunaConfig->IsElunaCompatibilityMode() && !sElunaConfig->IsElunaCompatibilityMapThreads() && num_threads > 1)
     {
         // Force 1 thread for Eluna if compatibility mode is enabled. Compatibility mode is single state and does not allow more update threads.
         sLog.outError("Map update threads set to %i, when Eluna in compatibility mode only allows 1, changing to 1", num_threads);
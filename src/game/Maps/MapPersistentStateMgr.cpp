@@ -48,7 +48,7 @@ static uint32 resetEventTypeDelay[MAX_RESET_EVENT_TYPE] = { 0,
 //== MapPersistentState functions ==========================
 MapPersistentState::MapPersistentState(uint16 MapId, uint32 InstanceId)
     : m_instanceid(InstanceId), m_mapid(MapId),
-      m_usedByMap(NULL)
+      m_usedByMap(NULL), m_respawnSaveTimer(0)
 {
 }
 
@@ -78,55 +78,100 @@ bool MapPersistentState::UnloadIfEmpty()
 void MapPersistentState::SaveCreatureRespawnTime(uint32 loguid, time_t t)
 {
     SetCreatureRespawnTime(loguid, t);
+    MarkRespawnTimeUnsaved(m_unsavedCreatureRespawnTimes, loguid);
+}
+
+void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
+{
+    SetGORespawnTime(loguid, t);
+    MarkRespawnTimeUnsaved(m_unsavedGORespawnTimes, loguid);
+}
 
+void MapPersistentState::MarkRespawnTimeUnsaved(UnsavedRespawnTimes& unsaved, uint32 loguid)
+{
     // BGs/Arenas always reset at server restart/unload, so no reason store in DB
     if (GetMapEntry()->IsBattleGround())
     {
         return;
     }
 
-    CharacterDatabase.BeginTransaction();
-
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM `creature_respawn` WHERE `guid` = ? AND `instance` = ?");
-    stmt.PExecute(loguid, m_instanceid);
+    unsaved.insert(loguid);
 
-    if (t > sWorld.GetGameTime())
+    // without a map nothing would update the save timer
+    if (!m_usedByMap || !sWorld.getConfig(CONFIG_UINT32_INTERVAL_RESPAWN_SAVE))
     {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO `creature_respawn` VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
+        SaveRespawnTimes();
     }
+}
 
-    CharacterDatabase.CommitTransaction();
+void MapPersistentState::UpdateRespawnTimes(uint32 diff)
+{
+    m_respawnSaveTimer += diff;
+    if (m_respawnSaveTimer >= sWorld.getConfig(CONFIG_UINT32_INTERVAL_RESPAWN_SAVE))
+    {
+        SaveRespawnTimes();
+    }
 }
 
-void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
+void MapPersistentState::SaveRespawnTimes()
 {
-    SetGORespawnTime(loguid, t);
+    m_respawnSaveTimer = 0;
 
-    // BGs/Arenas always reset at server restart/unload, so no reason store in DB
-    if (GetMapEntry()->IsBattleGround())
+    if (m_unsavedCreatureRespawnTimes.empty() && m_unsavedGORespawnTimes.empty())
     {
         return;
     }
 
     CharacterDatabase.BeginTransaction();
+    SaveRespawnTimes("creature_respawn", m_creatureRespawnTimes, m_unsavedCreatureRespawnTimes);
+    SaveRespawnTimes("gameobject_respawn", m_goRespawnTimes, m_unsavedGORespawnTimes);
+    CharacterDatabase.CommitTransaction();
+}
 
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
+void MapPersistentState::SaveRespawnTimes(char const* table, RespawnTimes const& times, UnsavedRespawnTimes& unsaved)
+{
+    // rows per statement, keeps the statements well below MAX_QUERY_LEN
+    static const uint32 batchSize = 500;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM `gameobject_respawn` WHERE `guid` = ? AND `instance` = ?");
-    stmt.PExecute(loguid, m_instanceid);
+    std::ostringstream replaceSql, deleteSql;
+    uint32 replaceCount = 0, deleteCount = 0;
 
-    if (t > sWorld.GetGameTime())
+    for (UnsavedRespawnTimes::const_iterator itr = unsaved.begin(); itr != unsaved.end(); ++itr)
+    {
+        RespawnTimes::const_iterator respawn = times.find(*itr);
+        if (respawn != times.end())
+        {
+            replaceSql << (replaceCount ? ", (" : "(") << *itr << ", " << uint64(respawn->second) << ", " << m_instanceid << ")";
+            if (++replaceCount == batchSize)
+            {
+                CharacterDatabase.PExecute("REPLACE INTO `%s` (`guid`, `respawntime`, `instance`) VALUES %s", table, replaceSql.str().c_str());
+                replaceSql.str("");
+                replaceCount = 0;
+            }
+        }
+        else
+        {
+            deleteSql << (deleteCount ? ", " : "") << *itr;
+            if (++deleteCount == batchSize)
+            {
+                CharacterDatabase.PExecute("DELETE FROM `%s` WHERE `instance` = '%u' AND `guid` IN (%s)", table, m_instanceid, deleteSql.str().c_str());
+                deleteSql.str("");
+                deleteCount = 0;
+            }
+        }
+    }
+
+    if (replaceCount)
     {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO `gameobject_respawn` VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
+        CharacterDatabase.PExecute("REPLACE INTO `%s` (`guid`, `respawntime`, `instance`) VALUES %s", table, replaceSql.str().c_str());
     }
 
-    CharacterDatabase.CommitTransaction();
+    if (deleteCount)
+    {
+        CharacterDatabase.PExecute("DELETE FROM `%s` WHERE `instance` = '%u' AND `guid` IN (%s)", table, m_instanceid, deleteSql.str().c_str());
+    }
+
+    unsaved.clear();
 }
 
 void MapPersistentState::SetCreatureRespawnTime(uint32 loguid, time_t t)
@@ -159,6 +204,8 @@ void MapPersistentState::ClearRespawnTimes()
 {
     m_goRespawnTimes.clear();
     m_creatureRespawnTimes.clear();
+    m_unsavedGORespawnTimes.clear();
+    m_unsavedCreatureRespawnTimes.clear();
 
     UnloadIfEmpty();
 }
@@ -86,6 +86,7 @@ class MapPersistentState
             m_usedByMap = map;
             if (!map)
             {
+                SaveRespawnTimes();
                 UnloadIfEmpty();
             }
         }
@@ -103,6 +104,10 @@ class MapPersistentState
         }
         void SaveGORespawnTime(uint32 loguid, time_t t);
 
+        // respawn time changes are collected and written in batches, at most RespawnTimeSaveInterval ms late
+        void UpdateRespawnTimes(uint32 diff);
+        void SaveRespawnTimes();
+
         // pool system
         void InitPools();
         virtual SpawnedPoolData& GetSpawnedPoolData() = 0;
@@ -124,11 +129,15 @@ class MapPersistentState
         bool HasRespawnTimes() const { return !m_creatureRespawnTimes.empty() || !m_goRespawnTimes.empty(); }
 
     private:
+        typedef UNORDERED_MAP<uint32, time_t> RespawnTimes;
+        typedef UNORDERED_SET<uint32> UnsavedRespawnTimes;
+
         void SetCreatureRespawnTime(uint32 loguid, time_t t);
         void SetGORespawnTime(uint32 loguid, time_t t);
+        void MarkRespawnTimeUnsaved(UnsavedRespawnTimes& unsaved, uint32 loguid);
+        void SaveRespawnTimes(char const* table, RespawnTimes const& times, UnsavedRespawnTimes& unsaved);
 
     private:
-        typedef UNORDERED_MAP<uint32, time_t> RespawnTimes;
 
         uint32 m_instanceid;
         uint32 m_mapid;
@@ -137,6 +146,9 @@ class MapPersistentState
         // persistent data
         RespawnTimes m_creatureRespawnTimes;                // lock MapPersistentState from unload, for example for temporary bound dungeon unload delay
         RespawnTimes m_goRespawnTimes;                      // lock MapPersistentState from unload, for example for temporary bound dungeon unload delay
+        UnsavedRespawnTimes m_unsavedCreatureRespawnTimes;  // guids changed since the last SaveRespawnTimes
+        UnsavedRespawnTimes m_unsavedGORespawnTimes;
+        uint32 m_respawnSaveTimer;
         MapCellObjectGuidsMap m_gridObjectGuids;            // Single map copy specific grid spawn data, like pool spawns
 };
 
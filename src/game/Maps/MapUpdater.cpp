@@ -26,6 +26,9 @@
 #include "DelayExecutor.h"
 #include "Map.h"
 #include "DatabaseEnv.h"
+#ifdef ENABLE_ELUNA
+#include "LuaEngine.h"
+#endif /* ENABLE_ELUNA */
 
 #include <ace/Guard_T.h>
 #include <ace/Method_Request.h>
@@ -58,7 +61,13 @@ class MapUpdateRequest : public ACE_Method_Request
          */
         virtual int call()
         {
-            m_map.Update(m_diff);
+            {
+#ifdef ENABLE_ELUNA
+                // lua code of a shared state waits until this update reaches a hook or ends
+                Eluna::MapUpdateScope elunaScope(m_map.GetEluna(), &m_map);
+#endif /* ENABLE_ELUNA */
+                m_map.Update(m_diff);
+            }
             m_updater.update_finished();
             return 0;
         }
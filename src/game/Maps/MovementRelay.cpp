@@ -0,0 +1,137 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "MovementRelay.h"
+#include "Map.h"
+#include "Unit.h"
+#include "World.h"
+#include "GridNotifiers.h"
+#include "CellImpl.h"
+#include "Utilities/Timer.h"
+
+// pending entries of movers that stopped sending heartbeats are forgotten after this time
+#define MOVEMENT_RELAY_EXPIRE_TIME (10 * IN_MILLISECONDS)
+
+std::atomic<uint64> MovementRelay::s_sent(0);
+std::atomic<uint64> MovementRelay::s_coalesced(0);
+std::atomic<uint64> MovementRelay::s_thinned(0);
+
+void MovementRelay::QueueHeartbeat(Unit* mover, ObjectGuid skipped, WorldPacket const& data)
+{
+    PendingHeartbeat& heartbeat = m_heartbeats[mover->GetObjectGuid()];
+    if (heartbeat.pending)
+    {
+        ++s_coalesced;
+    }
+    else
+    {
+        heartbeat.queuedTime = getMSTime();
+        heartbeat.pending = true;
+    }
+
+    heartbeat.data = data;
+    heartbeat.skipped = skipped;
+    heartbeat.x = mover->GetPositionX();
+    heartbeat.y = mover->GetPositionY();
+    heartbeat.z = mover->GetPositionZ();
+}
+
+void MovementRelay::DropHeartbeat(Unit* mover)
+{
+    PendingHeartbeatMap::iterator itr = m_heartbeats.find(mover->GetObjectGuid());
+    if (itr != m_heartbeats.end() && itr->second.pending)
+    {
+        itr->second.pending = false;
+        ++s_coalesced;
+    }
+}
+
+void MovementRelay::Update()
+{
+    if (m_heartbeats.empty())
+    {
+        return;
+    }
+
+    uint32 now = getMSTime();
+    uint32 window = sWorld.getConfig(CONFIG_UINT32_MOVEMENT_RELAY_WINDOW);
+    float nearDist = m_map.GetInterestDistance();
+
+    for (PendingHeartbeatMap::iterator itr = m_heartbeats.begin(); itr != m_heartbeats.end();)
+    {
+        PendingHeartbeat& heartbeat = itr->second;
+        uint32 age = getMSTimeDiff(heartbeat.queuedTime, now);
+
+        if (!heartbeat.pending)
+        {
+            if (age > MOVEMENT_RELAY_EXPIRE_TIME)
+            {
+                m_heartbeats.erase(itr++);
+            }
+            else
+            {
+                ++itr;
+            }
+            continue;
+        }
+
+        if (age < window)
+        {
+            ++itr;
+            continue;
+        }
+
+        Unit* mover = m_map.GetUnit(itr->first);
+        if (!mover || !mover->IsInWorld())
+        {
+            m_heartbeats.erase(itr++);
+            continue;
+        }
+
+        heartbeat.pending = false;
+        heartbeat.queuedTime = now;
+
+        // teleported or moved by server since queued, heartbeat would show old position
+        if (mover->GetPositionX() != heartbeat.x || mover->GetPositionY() != heartbeat.y || mover->GetPositionZ() != heartbeat.z)
+        {
+            ++s_coalesced;
+            ++itr;
+            continue;
+        }
+
+        MaNGOS::MovementRelayDeliverer notifier(*mover, &heartbeat.data, heartbeat.skipped, heartbeat.sequence++, nearDist);
+        Cell::VisitWorldObjects(mover, notifier, m_map.GetVisibilityDistance());
+
+        s_sent += notifier.i_sent;
+        s_thinned += notifier.i_thinned;
+        ++itr;
+    }
+}
+
+void MovementRelay::GetStatistic(uint64& sent, uint64& coalesced, uint64& thinned)
+{
+    sent = s_sent;
+    coalesced = s_coalesced;
+    thinned = s_thinned;
+}
@@ -0,0 +1,82 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_MOVEMENTRELAY_H
+#define MANGOS_MOVEMENTRELAY_H
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+
+#include <atomic>
+
+class Map;
+class Unit;
+
+/**
+ * Relays movement heartbeats of player controlled movers to the players around them.
+ *
+ * A heartbeat only repeats movement state the observers already extrapolate, so the last one of
+ * each mover is held for MovementRelay.Window msecs and replaced by any newer movement packet of
+ * the same mover. Observers beyond the map interest distance get only every second heartbeat,
+ * and beyond twice that distance every fourth one. Used from the owning map update thread only.
+ */
+class MovementRelay
+{
+    public:
+        explicit MovementRelay(Map& map) : m_map(map) {}
+
+        // keep heartbeat of the mover until the window ends, replacing the pending one
+        void QueueHeartbeat(Unit* mover, ObjectGuid skipped, WorldPacket const& data);
+        // forget pending heartbeat, a newer movement packet of the mover is sent right away
+        void DropHeartbeat(Unit* mover);
+        // send heartbeats which window has ended
+        void Update();
+
+        static void GetStatistic(uint64& sent, uint64& coalesced, uint64& thinned);
+
+    private:
+        struct PendingHeartbeat
+        {
+            PendingHeartbeat() : queuedTime(0), sequence(0), x(0.0f), y(0.0f), z(0.0f), pending(false) {}
+
+            WorldPacket data;
+            ObjectGuid skipped;                             // controller of the mover, it does not get its own movement back
+            uint32 queuedTime;
+            uint32 sequence;                                // heartbeats relayed for the mover, used to thin far observers
+            float x, y, z;                                  // mover position at queue time, mover relocated by server in other case
+            bool pending;
+        };
+
+        typedef UNORDERED_MAP<ObjectGuid, PendingHeartbeat> PendingHeartbeatMap;
+
+        Map& m_map;
+        PendingHeartbeatMap m_heartbeats;
+
+        static std::atomic<uint64> s_sent;                  // heartbeat packets sent to observers
+        static std::atomic<uint64> s_coalesced;             // heartbeats replaced by newer movement before sending
+        static std::atomic<uint64> s_thinned;               // heartbeat packets not sent to far observers
+};
+
+#endif
@@ -129,6 +129,7 @@ void LoadHelper(CellGuidSet const& guid_set, CellPair& cell, GridRefManager<T>&
         }
 
         grid.AddGridObject(obj);
+        obj->AddToObjectIndex(grid.GetObjectIndex(), 0);
 
         addUnitState(obj, cell);
         obj->SetMap(map);
@@ -172,6 +173,7 @@ void LoadHelper(CellCorpseSet const& cell_corpses, CellPair& cell, CorpseMapType
         }
 
         grid.AddWorldObject(obj);
+        obj->AddToObjectIndex(grid.GetObjectIndex(), GRID_INDEX_FLAG_WORLD_CONTAINER);
 
         addUnitState(obj, cell);
         obj->SetMap(map);
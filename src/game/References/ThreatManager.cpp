@@ -243,24 +243,34 @@ void ThreatContainer::clearReferences()
         delete(*i);
     }
     iThreatList.clear();
+    iThreatListIndex.clear();
 }
 
 //============================================================
-// Return the HostileReference of NULL, if not found
-HostileReference* ThreatContainer::getReferenceByTarget(Unit* pVictim)
+
+void ThreatContainer::addReference(HostileReference* pHostileReference)
 {
-    HostileReference* result = NULL;
-    ObjectGuid guid = pVictim->GetObjectGuid();
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
+    iThreatListIndex[pHostileReference->getUnitGuid()] = iThreatList.insert(iThreatList.end(), pHostileReference);
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* pRef)
+{
+    ThreatListIndex::iterator itr = iThreatListIndex.find(pRef->getUnitGuid());
+    if (itr != iThreatListIndex.end() && *itr->second == pRef)
     {
-        if ((*i)->getUnitGuid() == guid)
-        {
-            result = (*i);
-            break;
-        }
+        iThreatList.erase(itr->second);
+        iThreatListIndex.erase(itr);
     }
+}
 
-    return result;
+//============================================================
+// Return the HostileReference of NULL, if not found
+HostileReference* ThreatContainer::getReferenceByTarget(Unit* pVictim)
+{
+    ThreatListIndex::const_iterator itr = iThreatListIndex.find(pVictim->GetObjectGuid());
+    return itr != iThreatListIndex.end() ? *itr->second : NULL;
 }
 
 //============================================================
@@ -309,7 +319,44 @@ void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
     {
-        iThreatList.sort(HostileReferenceSortPredicate);
+        // Between two updates usually only a few references change their threat, so the list
+        // is nearly sorted: move just the out of order references into place with an insertion
+        // pass and keep the full sort for a heavily shuffled list
+        uint32 unsorted = 0;
+        for (ThreatList::const_iterator prev = iThreatList.begin(), itr = std::next(prev); itr != iThreatList.end(); prev = itr++)
+        {
+            if (HostileReferenceSortPredicate(*itr, *prev))
+            {
+                ++unsorted;
+            }
+        }
+
+        if (unsorted > iThreatList.size() / 8 + 2)
+        {
+            iThreatList.sort(HostileReferenceSortPredicate);
+        }
+        else if (unsorted)
+        {
+            for (ThreatList::iterator itr = std::next(iThreatList.begin()); itr != iThreatList.end();)
+            {
+                ThreatList::iterator pos = std::prev(itr);
+                if (!HostileReferenceSortPredicate(*itr, *pos))
+                {
+                    ++itr;
+                    continue;
+                }
+
+                // stable: stop behind references with equal threat
+                while (pos != iThreatList.begin() && HostileReferenceSortPredicate(*itr, *std::prev(pos)))
+                {
+                    --pos;
+                }
+
+                ThreatList::iterator next = std::next(itr);
+                iThreatList.splice(pos, iThreatList, itr); // iterators stay valid, the index needs no update
+                itr = next;
+            }
+        }
     }
     iDirty = false;
 }
@@ -30,6 +30,8 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "UnitEvents.h"
 #include "ObjectGuid.h"
+#include "Utilities/UnorderedMapSet.h"
+#include "Utilities/ObjectPool.h"
 #include <list>
 
 //==============================================================
@@ -51,6 +53,8 @@ class ThreatCalcHelper
 //==============================================================
 class HostileReference : public Reference<Unit, ThreatManager>
 {
+        MANGOS_POOLED_OBJECT(HostileReference)
+
     public:
         HostileReference(Unit* pUnit, ThreatManager* pThreatManager, float pThreat);
 
@@ -142,13 +146,17 @@ typedef std::list<HostileReference*> ThreatList;
 class ThreatContainer
 {
     private:
+        // list position of every reference, for O(1) lookup and removal by target guid
+        typedef UNORDERED_MAP<ObjectGuid, ThreatList::iterator> ThreatListIndex;
+
         ThreatList iThreatList;
+        ThreatListIndex iThreatListIndex;
         bool iDirty;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* pRef) { iThreatList.remove(pRef); }
-        void addReference(HostileReference* pHostileReference) { iThreatList.push_back(pHostileReference); }
+        void remove(HostileReference* pRef);
+        void addReference(HostileReference* pHostileReference);
         void clearReferences();
         // Sort the list if necessary
         void update();
@@ -139,7 +139,7 @@ void InitializeOpcodes()
     OPCODE(SMSG_PET_NAME_QUERY_RESPONSE,                   STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(CMSG_GUILD_QUERY,                               STATUS_AUTHED,   PROCESS_THREADUNSAFE, &WorldSession::HandleGuildQueryOpcode);
     OPCODE(SMSG_GUILD_QUERY_RESPONSE,                      STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
-    OPCODE(CMSG_ITEM_QUERY_SINGLE,                         STATUS_LOGGEDIN, PROCESS_INPLACE,      &WorldSession::HandleItemQuerySingleOpcode);
+    OPCODE(CMSG_ITEM_QUERY_SINGLE,                         STATUS_LOGGEDIN, PROCESS_THREADUNSAFE, &WorldSession::HandleItemQuerySingleOpcode);
     OPCODE(CMSG_ITEM_QUERY_MULTIPLE,                       STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_NULL);
     OPCODE(SMSG_ITEM_QUERY_SINGLE_RESPONSE,                STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(SMSG_ITEM_QUERY_MULTIPLE_RESPONSE,              STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
@@ -147,7 +147,7 @@ void InitializeOpcodes()
     OPCODE(SMSG_PAGE_TEXT_QUERY_RESPONSE,                  STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(CMSG_QUEST_QUERY,                               STATUS_LOGGEDIN, PROCESS_THREADUNSAFE, &WorldSession::HandleQuestQueryOpcode);
     OPCODE(SMSG_QUEST_QUERY_RESPONSE,                      STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
-    OPCODE(CMSG_GAMEOBJECT_QUERY,                          STATUS_LOGGEDIN, PROCESS_INPLACE,      &WorldSession::HandleGameObjectQueryOpcode);
+    OPCODE(CMSG_GAMEOBJECT_QUERY,                          STATUS_LOGGEDIN, PROCESS_THREADUNSAFE, &WorldSession::HandleGameObjectQueryOpcode);
     OPCODE(SMSG_GAMEOBJECT_QUERY_RESPONSE,                 STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(CMSG_CREATURE_QUERY,                            STATUS_LOGGEDIN, PROCESS_INPLACE,      &WorldSession::HandleCreatureQueryOpcode);
     OPCODE(SMSG_CREATURE_QUERY_RESPONSE,                   STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
@@ -515,7 +515,7 @@ void InitializeOpcodes()
     OPCODE(SMSG_NOTIFICATION,                              STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(CMSG_PLAYED_TIME,                               STATUS_LOGGEDIN, PROCESS_THREADSAFE,   &WorldSession::HandlePlayedTime);
     OPCODE(SMSG_PLAYED_TIME,                               STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
-    OPCODE(CMSG_QUERY_TIME,                                STATUS_LOGGEDIN, PROCESS_THREADSAFE,   &WorldSession::HandleQueryTimeOpcode);
+    OPCODE(CMSG_QUERY_TIME,                                STATUS_LOGGEDIN, PROCESS_QUERY,        &WorldSession::HandleQueryTimeOpcode);
     OPCODE(SMSG_QUERY_TIME_RESPONSE,                       STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(SMSG_LOG_XPGAIN,                                STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
     OPCODE(SMSG_AURACASTLOG,                               STATUS_NEVER,    PROCESS_INPLACE,      &WorldSession::Handle_ServerSide);
@@ -982,12 +982,14 @@ enum SessionStatus
  * same function as we received it in, this is unusual, or it can be in:
  * - \ref World::UpdateSessions if it's not thread safe
  * - \ref Map::Update if it is thread safe
+ * - \ref QueryOpcodeProcessor if it only reads static data
  */
 enum PacketProcessing
 {
     PROCESS_INPLACE = 0,   ///< process packet whenever we receive it - mostly for non-handled or non-implemented packets
     PROCESS_THREADUNSAFE,  ///< packet is not thread-safe - process it in \ref World::UpdateSessions
-    PROCESS_THREADSAFE     ///< packet is thread-safe - process it in \ref Map::Update
+    PROCESS_THREADSAFE,    ///< packet is thread-safe - process it in \ref Map::Update
+    PROCESS_QUERY          ///< handler only reads static data and uses no player - process it in \ref QueryOpcodeProcessor, or like PROCESS_THREADSAFE if not running
 };
 
 class WorldPacket;
@@ -0,0 +1,128 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "QueryOpcodeProcessor.h"
+#include "WorldSession.h"
+#include "WorldPacket.h"
+
+#include <ace/Guard_T.h>
+#include <ace/Method_Request.h>
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<QueryOpcodeProcessor, ACE_Thread_Mutex>
+INSTANTIATE_SINGLETON_2(QueryOpcodeProcessor, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(QueryOpcodeProcessor, ACE_Thread_Mutex);
+
+/**
+ * @brief A received query packet waiting for a pool thread.
+ */
+class QueryOpcodeRequest : public ACE_Method_Request
+{
+    private:
+        WorldSession& m_session; ///< Session that received the packet.
+        WorldPacket* m_packet; ///< The packet, deleted by the session.
+        QueryOpcodeProcessor& m_processor; ///< Reference to the processor.
+
+    public:
+        QueryOpcodeRequest(WorldSession& s, WorldPacket* p, QueryOpcodeProcessor& q)
+            : m_session(s), m_packet(p), m_processor(q)
+        {
+        }
+
+        virtual int call()
+        {
+            m_session.ProcessQueryPacket(m_packet);
+            m_processor.request_finished();
+            return 0;
+        }
+};
+
+QueryOpcodeProcessor::QueryOpcodeProcessor() :
+    m_executor(), m_mutex(), m_condition(m_mutex), m_active(false), pending_requests(0)
+{
+}
+
+QueryOpcodeProcessor::~QueryOpcodeProcessor()
+{
+    deactivate();
+}
+
+int QueryOpcodeProcessor::activate(size_t num_threads)
+{
+    if (m_executor._activate((int)num_threads) == -1)
+    {
+        return -1;
+    }
+
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_mutex, -1);
+    m_active = true;
+    return 0;
+}
+
+int QueryOpcodeProcessor::deactivate()
+{
+    {
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_mutex, -1);
+
+        // packets received from now on stay in the session queue
+        m_active = false;
+
+        while (pending_requests > 0)
+        {
+            m_condition.wait();
+        }
+    }
+
+    return m_executor.deactivate();
+}
+
+bool QueryOpcodeProcessor::schedule(WorldSession& session, WorldPacket* packet)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_mutex, false);
+
+    if (!m_active)
+    {
+        return false;
+    }
+
+    // counted before the request can run, it is released by WorldSession::ProcessQueryPacket
+    session.AddPendingQuery();
+    ++pending_requests;
+
+    if (m_executor.execute(new QueryOpcodeRequest(session, packet, *this)) == -1)
+    {
+        session.RemovePendingQuery();
+        --pending_requests;
+        return false;
+    }
+
+    return true;
+}
+
+void QueryOpcodeProcessor::request_finished()
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_mutex);
+
+    --pending_requests;
+    m_condition.broadcast();
+}
@@ -0,0 +1,87 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_QUERYOPCODEPROCESSOR_H
+#define MANGOS_QUERYOPCODEPROCESSOR_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include "DelayExecutor.h"
+
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+class WorldSession;
+class WorldPacket;
+
+/**
+ * @brief Runs PROCESS_QUERY opcode handlers on a small thread pool as soon as they are received.
+ *
+ * Those handlers only read static data and the session locale, so they do not need to wait
+ * for World::UpdateSessions or Map::Update. The session keeps a count of its scheduled
+ * packets and is not destroyed before it reaches zero.
+ */
+class QueryOpcodeProcessor : public MaNGOS::Singleton<QueryOpcodeProcessor, MaNGOS::ClassLevelLockable<QueryOpcodeProcessor, ACE_Thread_Mutex> >
+{
+        friend class MaNGOS::OperatorNew<QueryOpcodeProcessor>;
+        friend class QueryOpcodeRequest;
+
+    public:
+        /**
+         * @brief Starts the pool, 0 threads keeps query opcodes in the session queue.
+         * @param num_threads Number of threads to activate.
+         * @return Result of the activation.
+         */
+        int activate(size_t num_threads);
+
+        /**
+         * @brief Refuses new packets, waits for the scheduled ones and stops the pool.
+         * @return Result of the deactivation.
+         */
+        int deactivate();
+
+        /**
+         * @brief Hands a packet over to the pool.
+         * @param session Session that received the packet.
+         * @param packet Packet to process, owned by the pool on success.
+         * @return False if the pool is not running, the packet must then be queued as usual.
+         */
+        bool schedule(WorldSession& session, WorldPacket* packet);
+
+    private:
+        QueryOpcodeProcessor();
+        ~QueryOpcodeProcessor();
+
+        void request_finished();
+
+        DelayExecutor m_executor;                           ///< Executor for handling the query requests.
+        ACE_Thread_Mutex m_mutex;                           ///< Mutex for m_active and pending_requests.
+        ACE_Condition_Thread_Mutex m_condition;             ///< Signaled when a request is processed.
+        bool m_active;                                      ///< Accepts new requests.
+        size_t pending_requests;                            ///< Number of scheduled, unfinished requests.
+};
+
+#define sQueryOpcodeProcessor QueryOpcodeProcessor::Instance()
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "QueryResponseCache.h"
+
+#include <ace/Guard_T.h>
+
+#define CLASS_LOCK MaNGOS::ClassLevelLockable<QueryResponseCache, ACE_Thread_Mutex>
+INSTANTIATE_SINGLETON_2(QueryResponseCache, CLASS_LOCK);
+INSTANTIATE_CLASS_MUTEX(QueryResponseCache, ACE_Thread_Mutex);
+
+QueryResponseCache::QueryResponseCache()
+{
+    // generation 0 is never current, it is returned if Get fails to lock
+    for (int i = 0; i < MAX_QUERY_RESPONSE_TYPE; ++i)
+    {
+        m_generations[i] = 1;
+    }
+}
+
+QueryResponsePtr QueryResponseCache::Get(QueryResponseType type, uint32 entry, int locale, uint32& generation) const
+{
+    QueryResponsePtr result;
+    generation = 0;
+
+    ACE_READ_GUARD_RETURN(LockType, guard, m_locks[type], result);
+
+    generation = m_generations[type];
+
+    ResponseMap::const_iterator itr = m_responses[type].find(MakeKey(entry, locale));
+    if (itr != m_responses[type].end())
+    {
+        result = itr->second;
+    }
+
+    return result;
+}
+
+QueryResponsePtr QueryResponseCache::Store(QueryResponseType type, uint32 entry, int locale, WorldPacket const& packet, uint32 generation)
+{
+    // built outside of the lock, two threads may build the same response, the last one wins
+    QueryResponsePtr response(new WorldPacket(packet));
+
+    ACE_WRITE_GUARD_RETURN(LockType, guard, m_locks[type], response);
+
+    // the response may have been built from data read before a reload
+    if (generation != m_generations[type])
+    {
+        return response;
+    }
+
+    m_responses[type][MakeKey(entry, locale)] = response;
+    return response;
+}
+
+void QueryResponseCache::Invalidate(QueryResponseType type)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_locks[type]);
+    ++m_generations[type];
+    m_responses[type].clear();
+}
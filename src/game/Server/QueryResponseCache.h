@@ -0,0 +1,110 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_QUERYRESPONSECACHE_H
+#define MANGOS_QUERYRESPONSECACHE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include "Utilities/UnorderedMapSet.h"
+#include "WorldPacket.h"
+
+#include <ace/RW_Thread_Mutex.h>
+#include <memory>
+
+/**
+ * @brief Kinds of static query responses kept by QueryResponseCache.
+ */
+enum QueryResponseType
+{
+    QUERY_RESPONSE_ITEM         = 0,                        ///< SMSG_ITEM_QUERY_SINGLE_RESPONSE
+    QUERY_RESPONSE_ITEM_NAME    = 1,                        ///< SMSG_ITEM_NAME_QUERY_RESPONSE
+    QUERY_RESPONSE_CREATURE     = 2,                        ///< SMSG_CREATURE_QUERY_RESPONSE, type and display id are patched per unit
+    QUERY_RESPONSE_GAMEOBJECT   = 3,                        ///< SMSG_GAMEOBJECT_QUERY_RESPONSE
+    QUERY_RESPONSE_QUEST        = 4,                        ///< SMSG_QUEST_QUERY_RESPONSE
+    QUERY_RESPONSE_PAGE_TEXT    = 5,                        ///< SMSG_PAGE_TEXT_QUERY_RESPONSE, one page per entry
+    QUERY_RESPONSE_NPC_TEXT     = 6                         ///< SMSG_NPC_TEXT_UPDATE
+};
+
+#define MAX_QUERY_RESPONSE_TYPE 7
+
+typedef std::shared_ptr<WorldPacket const> QueryResponsePtr;
+
+/**
+ * @brief Serialized responses to static data queries, per entry and session locale.
+ *
+ * Responses are stored the first time they are built by the query handlers and then sent
+ * as they are. The cached data must be dropped by the .reload commands of its sources.
+ * Each drop starts a new generation, responses built under an older one are not stored.
+ * Lookups may happen from the world, map and query opcode threads.
+ */
+class QueryResponseCache : public MaNGOS::Singleton<QueryResponseCache, MaNGOS::ClassLevelLockable<QueryResponseCache, ACE_Thread_Mutex> >
+{
+        friend class MaNGOS::OperatorNew<QueryResponseCache>;
+
+    public:
+        /**
+         * @brief Finds a cached response.
+         * @param type Kind of response.
+         * @param entry Queried entry.
+         * @param locale Db locale index of the session, -1 for the default locale.
+         * @param generation Set to the current generation, to be passed to Store.
+         * @return The response, empty if not built yet.
+         */
+        QueryResponsePtr Get(QueryResponseType type, uint32 entry, int locale, uint32& generation) const;
+
+        /**
+         * @brief Stores a copy of a built response.
+         * @param type Kind of response.
+         * @param entry Queried entry.
+         * @param locale Db locale index of the session, -1 for the default locale.
+         * @param packet The response.
+         * @param generation Generation returned by Get before the response was built.
+         * @return The response, not stored if the kind was invalidated since Get.
+         */
+        QueryResponsePtr Store(QueryResponseType type, uint32 entry, int locale, WorldPacket const& packet, uint32 generation);
+
+        /**
+         * @brief Drops all responses of a kind, packets still held by senders stay valid.
+         * @param type Kind of response.
+         */
+        void Invalidate(QueryResponseType type);
+
+    private:
+        QueryResponseCache();
+        ~QueryResponseCache() {}
+
+        typedef UNORDERED_MAP<uint64, QueryResponsePtr> ResponseMap;
+        typedef ACE_RW_Thread_Mutex LockType;
+
+        static uint64 MakeKey(uint32 entry, int locale) { return (uint64(uint32(locale + 1)) << 32) | entry; }
+
+        ResponseMap m_responses[MAX_QUERY_RESPONSE_TYPE];
+        uint32 m_generations[MAX_QUERY_RESPONSE_TYPE];      // incremented by Invalidate
+        mutable LockType m_locks[MAX_QUERY_RESPONSE_TYPE];
+};
+
+#define sQueryResponseCache QueryResponseCache::Instance()
+
+#endif
@@ -42,6 +42,8 @@
 #include "ObjectAccessor.h"
 #include "BattleGround/BattleGroundMgr.h"
 #include "SocialMgr.h"
+#include "TickProfiler.h"
+#include "QueryOpcodeProcessor.h"
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
 #endif /* ENABLE_ELUNA */
@@ -107,7 +109,8 @@ WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, time_
     _player(NULL), m_Socket(sock), _security(sec), _accountId(id), _warden(NULL), _build(0), _logoutTime(0),
     m_inQueue(false), m_playerLoading(false), m_playerLogout(false), m_playerRecentlyLogout(false), m_playerSave(false),
     m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)), m_sessionDbLocaleIndex(sObjectMgr.GetIndexForLocale(locale)),
-    m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED)
+    m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED), m_queryReady(false), m_pendingQueries(0),
+    m_pendingQueriesDone(m_pendingQueriesLock)
 {
     if (sock)
     {
@@ -119,6 +122,15 @@ WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, time_
 /// WorldSession destructor
 WorldSession::~WorldSession()
 {
+    ///- query threads may still use the session and its socket
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, m_pendingQueriesLock);
+        while (m_pendingQueries)
+        {
+            m_pendingQueriesDone.wait();
+        }
+    }
+
     ///- unload player if not unloaded
     if (_player)
     {
@@ -231,9 +243,66 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
+    // read-only queries are answered at once by the query threads
+    if (opcodeTable[new_packet->GetOpcode()].packetProcessing == PROCESS_QUERY && m_queryReady && sQueryOpcodeProcessor.schedule(*this, new_packet))
+    {
+        return;
+    }
+
     _recvQueue.add(new_packet);
 }
 
+/// Process a PROCESS_QUERY packet on a query thread, the handler must only use static data, the locale and SendPacket
+void WorldSession::ProcessQueryPacket(WorldPacket* packet)
+{
+    // the player may have logged out or left the world since the packet was scheduled,
+    // the packet is then dropped like STATUS_LOGGEDIN packets in Update
+    if (m_queryReady)
+    {
+        OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
+        try
+        {
+            if (sTickProfiler.IsEnabled())
+            {
+                TickProfiler::Clock::time_point start = TickProfiler::Clock::now();
+                (this->*opHandle.handler)(*packet);
+                sTickProfiler.AddOpcodeTime(packet->GetOpcode(), TickProfiler::ElapsedUs(start));
+            }
+            else
+            {
+                (this->*opHandle.handler)(*packet);
+            }
+        }
+        catch (ByteBufferException&)
+        {
+            sLog.outError("WorldSession::ProcessQueryPacket ByteBufferException occured while parsing a packet (opcode: %u) from client %s, accountid=%i.",
+                          packet->GetOpcode(), GetRemoteAddress().c_str(), GetAccountId());
+
+            if (sWorld.getConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET))
+            {
+                DETAIL_LOG("Disconnecting session [account id %u / address %s] for badly formatted packet.",
+                           GetAccountId(), GetRemoteAddress().c_str());
+
+                m_Socket->CloseSocket();
+            }
+        }
+    }
+
+    delete packet;
+
+    // last access to the session, it may be deleted right after
+    RemovePendingQuery();
+}
+
+void WorldSession::RemovePendingQuery()
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_pendingQueriesLock);
+    if (--m_pendingQueries == 0)
+    {
+        m_pendingQueriesDone.broadcast();
+    }
+}
+
 /// Logging helper for unexpected opcodes
 void WorldSession::LogUnexpectedOpcode(WorldPacket* packet, const char* reason)
 {
@@ -379,8 +448,8 @@ bool WorldSession::Update(PacketFilter& updater)
     }
 #endif
 
-    ///- Cleanup socket pointer if need
-    if (m_Socket && m_Socket->IsClosed())
+    ///- Cleanup socket pointer if need, not while query threads may still send to it
+    if (m_Socket && m_Socket->IsClosed() && !m_pendingQueries)
     {
         m_Socket->RemoveReference();
         m_Socket = NULL;
@@ -896,7 +965,17 @@ void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket* pac
         _player->SetCanDelayTeleport(true);
     }
 
-    (this->*opHandle.handler)(*packet);
+    if (sTickProfiler.IsEnabled())
+    {
+        uint16 opcode = packet->GetOpcode();
+        TickProfiler::Clock::time_point start = TickProfiler::Clock::now();
+        (this->*opHandle.handler)(*packet);
+        sTickProfiler.AddOpcodeTime(opcode, TickProfiler::ElapsedUs(start));
+    }
+    else
+    {
+        (this->*opHandle.handler)(*packet);
+    }
 
     if (_player)
     {
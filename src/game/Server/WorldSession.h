@@ -31,6 +31,10 @@
 #include "../AuctionHouse/AuctionHouseMgr.h"
 #include "Item.h"
 
+#include <atomic>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
 struct ItemPrototype;
 struct AuctionEntry;
 struct AuctionHouseEntry;
@@ -185,8 +189,19 @@ class WorldSession
         void SetPlayer(Player* plr)
         {
             _player = plr;
+            if (!plr)
+            {
+                m_queryReady = false;
+            }
         }
 
+        // PROCESS_QUERY packets, see QueryOpcodeProcessor
+        void ProcessQueryPacket(WorldPacket* packet);
+        void AddPendingQuery() { ++m_pendingQueries; }
+        void RemovePendingQuery();
+        // called when the player is added to or removed from its map
+        void SetPlayerInWorld(bool inWorld) { m_queryReady = inWorld; }
+
         // Warden
         void InitWarden(uint16 build, BigNumber* k, std::string const& os);
 
@@ -768,6 +783,10 @@ class WorldSession
         TutorialDataState m_tutorialState;
         uint32 m_clientTimeDelay;
         ACE_Based::LockedQueue<WorldPacket*, ACE_Thread_Mutex> _recvQueue;
+        std::atomic<bool> m_queryReady;                     // player logged in and in world, PROCESS_QUERY packets may bypass _recvQueue
+        std::atomic<uint32> m_pendingQueries;               // packets handed to QueryOpcodeProcessor, socket and session are kept until 0
+        ACE_Thread_Mutex m_pendingQueriesLock;
+        ACE_Condition_Thread_Mutex m_pendingQueriesDone;    // signaled when m_pendingQueries reaches 0
 };
 #endif
 /// @}
@@ -33,6 +33,7 @@
 #include "LootMgr.h"
 #include "Unit.h"
 #include "Player.h"
+#include "Utilities/ObjectPool.h"
 
 class WorldSession;
 class WorldPacket;
@@ -218,6 +219,8 @@ typedef std::multimap<uint64, uint64> SpellTargetTimeMap;
 
 class Spell
 {
+        MANGOS_POOLED_OBJECT(Spell)
+
         friend struct MaNGOS::SpellNotifierPlayer;
         friend struct MaNGOS::SpellNotifierCreatureAndPlayer;
         friend void Unit::SetCurrentCastedSpell(Spell* pSpell);
@@ -444,7 +447,8 @@ class Spell
         void CleanupTargetList();
         void ClearCastItem();
 
-        typedef std::list<Unit*> UnitList;
+        // target lists only live while targets are selected, in the map tick arena when cast by a map update
+        typedef std::list<Unit*, MaNGOS::TickAllocator<Unit*> > UnitList;
 
         void SetSelfContainer(Spell** pCurrentContainer) { m_selfContainer = pCurrentContainer; }
         Spell** GetSelfContainer() { return m_selfContainer; }
@@ -733,18 +737,28 @@ namespace MaNGOS
                 return;
             }
 
+            // GM OFF Spell must pass the checks.
+            bool gmSpell = (i_spell.m_spellInfo->Id == 1509);
+            // there are still more spells which can be casted on dead, but
+            // they are no AOE and don't have such a nice SPELL_ATTR flag
+            bool castOnDead = i_spell.m_spellInfo->HasAttribute(SPELL_ATTR_EX3_CAST_ON_DEAD);
+
             for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
             {
-                // GM OFF Spell must pass the checks.
-                bool gmSpell = (i_spell.m_spellInfo->Id == 1509);
-                // there are still more spells which can be casted on dead, but
-                // they are no AOE and don't have such a nice SPELL_ATTR flag
+                Unit* target = itr->getSource();
+
+                // the area test only reads positions, do it before the faction/state checks:
+                // most objects of the visited cells are outside the spell area
+                if (!IsInPushArea(target))
+                {
+                    continue;
+                }
 
                 if (!gmSpell)
                 {
-                    if ((i_TargetType != SPELL_TARGETS_ALL && !itr->getSource()->IsTargetableForAttack(i_spell.m_spellInfo->HasAttribute(SPELL_ATTR_EX3_CAST_ON_DEAD)))
+                    if ((i_TargetType != SPELL_TARGETS_ALL && !target->IsTargetableForAttack(castOnDead))
                         // mostly phase check
-                        || !itr->getSource()->IsInMap(i_originalCaster))
+                        || !target->IsInMap(i_originalCaster))
                         {
                             continue;
                         }
@@ -752,46 +766,46 @@ namespace MaNGOS
                     switch (i_TargetType)
                     {
                         case SPELL_TARGETS_HOSTILE:
-                            if (!i_originalCaster->IsHostileTo(itr->getSource()))
+                            if (!i_originalCaster->IsHostileTo(target))
                             {
                                 continue;
                             }
                             break;
                         case SPELL_TARGETS_NOT_FRIENDLY:
-                            if (i_originalCaster->IsFriendlyTo(itr->getSource()))
+                            if (i_originalCaster->IsFriendlyTo(target))
                             {
                                 continue;
                             }
                             break;
                         case SPELL_TARGETS_NOT_HOSTILE:
-                            if (i_originalCaster->IsHostileTo(itr->getSource()))
+                            if (i_originalCaster->IsHostileTo(target))
                             {
                                 continue;
                             }
                             break;
                         case SPELL_TARGETS_FRIENDLY:
-                            if (!i_originalCaster->IsFriendlyTo(itr->getSource()))
+                            if (!i_originalCaster->IsFriendlyTo(target))
                             {
                                 continue;
                             }
                             break;
                         case SPELL_TARGETS_AOE_DAMAGE:
                         {
-                            if (itr->getSource()->GetTypeId() == TYPEID_UNIT && ((Creature*)itr->getSource())->IsTotem())
+                            if (target->GetTypeId() == TYPEID_UNIT && ((Creature*)target)->IsTotem())
                             {
                                 continue;
                             }
 
                             if (i_playerControlled)
                             {
-                                if (i_originalCaster->IsFriendlyTo(itr->getSource()))
+                                if (i_originalCaster->IsFriendlyTo(target))
                                 {
                                     continue;
                                 }
                             }
                             else
                             {
-                                if (!i_originalCaster->IsHostileTo(itr->getSource()))
+                                if (!i_originalCaster->IsHostileTo(target))
                                 {
                                     continue;
                                 }
@@ -804,53 +818,30 @@ namespace MaNGOS
                     }
                 }
 
-                // we don't need to check InMap here, it's already done some lines above
-                switch (i_push_type)
-                {
-                    case PUSH_IN_FRONT:
-                        if (i_castingObject->IsInFront((Unit*)(itr->getSource()), i_radius, 2 * M_PI_F / 3))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_FRONT_90:
-                        if (i_castingObject->IsInFront((Unit*)(itr->getSource()), i_radius, M_PI_F / 2))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_FRONT_15:
-                        if (i_castingObject->IsInFront((Unit*)(itr->getSource()), i_radius, M_PI_F / 12))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_BACK:
-                        if (i_castingObject->IsInBack((Unit*)(itr->getSource()), i_radius, 2 * M_PI_F / 3))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_SELF_CENTER:
-                        if (i_castingObject->IsWithinDist((Unit*)(itr->getSource()), i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_DEST_CENTER:
-                        if (itr->getSource()->IsWithinDist3d(i_centerX, i_centerY, i_centerZ, i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_TARGET_CENTER:
-                        if (i_spell.m_targets.getUnitTarget() && i_spell.m_targets.getUnitTarget()->IsWithinDist((Unit*)(itr->getSource()), i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                }
+                i_data->push_back(target);
+            }
+        }
+
+        bool IsInPushArea(Unit* target) const
+        {
+            switch (i_push_type)
+            {
+                case PUSH_IN_FRONT:
+                    return i_castingObject->IsInFront(target, i_radius, 2 * M_PI_F / 3);
+                case PUSH_IN_FRONT_90:
+                    return i_castingObject->IsInFront(target, i_radius, M_PI_F / 2);
+                case PUSH_IN_FRONT_15:
+                    return i_castingObject->IsInFront(target, i_radius, M_PI_F / 12);
+                case PUSH_IN_BACK:
+                    return i_castingObject->IsInBack(target, i_radius, 2 * M_PI_F / 3);
+                case PUSH_SELF_CENTER:
+                    return i_castingObject->IsWithinDist(target, i_radius);
+                case PUSH_DEST_CENTER:
+                    return target->IsWithinDist3d(i_centerX, i_centerY, i_centerZ, i_radius);
+                case PUSH_TARGET_CENTER:
+                    return i_spell.m_targets.getUnitTarget() && i_spell.m_targets.getUnitTarget()->IsWithinDist(target, i_radius);
             }
+            return false;
         }
 
 #ifdef WIN32
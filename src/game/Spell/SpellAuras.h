@@ -28,6 +28,7 @@
 #include "SpellAuraDefines.h"
 #include "DBCEnums.h"
 #include "ObjectGuid.h"
+#include "Utilities/ObjectPool.h"
 
 /**
  * Used to modify what an \ref Aura does to a player/npc.
@@ -91,6 +92,8 @@ struct ReapplyAffectedPassiveAurasHelper;
  */
 class SpellAuraHolder
 {
+        MANGOS_POOLED_OBJECT(SpellAuraHolder)
+
     public:
         SpellAuraHolder(SpellEntry const* spellproto, Unit* target, WorldObject* caster, Item* castItem);
         Aura* m_auras[MAX_EFFECT_INDEX];
@@ -267,6 +270,8 @@ typedef void(Aura::*pAuraHandler)(bool Apply, bool Real);
 
 class Aura
 {
+        MANGOS_POOLED_OBJECT(Aura)
+
         friend struct ReapplyAffectedPassiveAurasHelper;
         friend Aura* CreateAura(SpellEntry const* spellproto, SpellEffectIndex eff, int32* currentBasePoints, SpellAuraHolder* holder, Unit* target, Unit* caster, Item* castItem);
 
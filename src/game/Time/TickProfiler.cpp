@@ -0,0 +1,405 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TickProfiler.h"
+
+#include "Config.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include "Database/DatabaseEnv.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+
+INSTANTIATE_SINGLETON_1(TickProfiler);
+
+static char const* const tickPhaseNames[MAX_TICK_PHASES] =
+{
+    "world.massmail",
+    "world.auctions",
+    "world.ahbot",
+    "world.playerbots",
+    "world.sessions",
+    "world.maps",
+    "world.battlegrounds",
+    "world.lfg",
+    "world.outdoorpvp",
+    "world.eluna",
+    "world.dbcallbacks",
+    "world.gameevents",
+    "world.removelist",
+    "world.persistentstates",
+    "world.cli",
+    "world.terrain",
+    "world.misc",
+    "map.sessions",
+    "map.players",
+    "map.cells",
+    "map.visibility",
+    "map.objectupdates",
+    "map.grids",
+    "map.scripts",
+    "map.eluna",
+    "map.instance"
+};
+
+static void AtomicMax(std::atomic<uint64>& target, uint64 value)
+{
+    uint64 current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void TickHistogram::Add(uint64 us)
+{
+    uint32 bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && (uint64(1) << bucket) <= us)
+    {
+        ++bucket;
+    }
+
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_total.fetch_add(us, std::memory_order_relaxed);
+    AtomicMax(m_max, us);
+}
+
+void TickHistogram::Reset()
+{
+    for (uint32 i = 0; i < BUCKET_COUNT; ++i)
+    {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+
+    m_count.store(0, std::memory_order_relaxed);
+    m_total.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64 TickHistogram::GetAverage() const
+{
+    uint64 count = GetCount();
+    return count ? GetTotal() / count : 0;
+}
+
+uint64 TickHistogram::GetPercentile(uint32 pct) const
+{
+    uint64 count = GetCount();
+    if (!count)
+    {
+        return 0;
+    }
+
+    uint64 wanted = (count * pct + 99) / 100;
+    uint64 seen = 0;
+    for (uint32 i = 0; i < BUCKET_COUNT - 1; ++i)
+    {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= wanted)
+        {
+            return std::min(uint64(1) << i, GetMax());
+        }
+    }
+
+    return GetMax();
+}
+
+TickProfiler::TickProfiler() : m_enabled(false), m_luaCalls(false), m_slowTickThreshold(0), m_metricsInterval(0), m_metricsTimer(0),
+    m_opcodes(new OpcodeCost[NUM_MSG_TYPES]), m_slowTicks(0), m_maxDbQueue(0)
+{
+    Reset();
+}
+
+TickProfiler::~TickProfiler()
+{
+    delete[] m_opcodes;
+}
+
+void TickProfiler::LoadFromConfig()
+{
+    m_enabled = sConfig.GetBoolDefault("TickProfiler.Enable", true);
+    m_luaCalls = sConfig.GetBoolDefault("TickProfiler.LuaCalls", false);
+    m_slowTickThreshold = sConfig.GetIntDefault("TickProfiler.SlowTickThreshold", 0);
+    m_metricsInterval = sConfig.GetIntDefault("TickProfiler.MetricsInterval", 60) * IN_MILLISECONDS;
+    m_metricsFile = sConfig.GetStringDefault("TickProfiler.MetricsFile", "");
+
+    if (!m_metricsFile.empty())
+    {
+        std::string logsDir = sConfig.GetStringDefault("LogsDir", "");
+        if (!logsDir.empty() && logsDir[logsDir.length() - 1] != '/' && logsDir[logsDir.length() - 1] != '\\')
+        {
+            logsDir.append("/");
+        }
+        m_metricsFile = logsDir + m_metricsFile;
+    }
+
+    m_metricsTimer = m_metricsInterval;
+}
+
+void TickProfiler::AddPhaseTime(TickProfilePhase phase, uint64 us)
+{
+    m_phases[phase].Add(us);
+    m_tickPhaseTime[phase].fetch_add(us, std::memory_order_relaxed);
+}
+
+void TickProfiler::AddOpcodeTime(uint16 opcode, uint64 us)
+{
+    if (opcode >= NUM_MSG_TYPES)
+    {
+        return;
+    }
+
+    OpcodeCost& cost = m_opcodes[opcode];
+    cost.count.fetch_add(1, std::memory_order_relaxed);
+    cost.total.fetch_add(us, std::memory_order_relaxed);
+    AtomicMax(cost.max, us);
+    AtomicMax(m_tickWorstOpcode, (us << 16) | opcode);
+}
+
+void TickProfiler::AddLuaCallTime(std::string const& function, uint64 us)
+{
+    std::lock_guard<std::mutex> guard(m_luaCallLock);
+
+    LuaCallCost& cost = m_luaCallCosts[function];
+    ++cost.count;
+    cost.total += us;
+    cost.max = std::max(cost.max, us);
+}
+
+void TickProfiler::EndWorldTick(uint32 diff, uint64 us)
+{
+    m_worldTick.Add(us);
+
+    size_t dbQueue = WorldDatabase.GetDelayQueueSize() + CharacterDatabase.GetDelayQueueSize() + LoginDatabase.GetDelayQueueSize();
+    m_maxDbQueue = std::max(m_maxDbQueue, dbQueue);
+
+    if (m_slowTickThreshold && us >= uint64(m_slowTickThreshold) * 1000)
+    {
+        ReportSlowTick(us);
+    }
+
+    for (uint32 i = 0; i < MAX_TICK_PHASES; ++i)
+    {
+        m_tickPhaseTime[i].store(0, std::memory_order_relaxed);
+    }
+    m_tickWorstOpcode.store(0, std::memory_order_relaxed);
+
+    if (!m_metricsFile.empty() && m_metricsInterval)
+    {
+        if (m_metricsTimer <= diff)
+        {
+            WriteMetricsFile();
+            m_metricsTimer = m_metricsInterval;
+        }
+        else
+        {
+            m_metricsTimer -= diff;
+        }
+    }
+}
+
+void TickProfiler::Reset()
+{
+    m_worldTick.Reset();
+
+    for (uint32 i = 0; i < MAX_TICK_PHASES; ++i)
+    {
+        m_phases[i].Reset();
+        m_tickPhaseTime[i].store(0, std::memory_order_relaxed);
+    }
+
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+    {
+        m_opcodes[i].count.store(0, std::memory_order_relaxed);
+        m_opcodes[i].total.store(0, std::memory_order_relaxed);
+        m_opcodes[i].max.store(0, std::memory_order_relaxed);
+    }
+
+    m_tickWorstOpcode.store(0, std::memory_order_relaxed);
+    m_slowTicks = 0;
+    m_maxDbQueue = 0;
+
+    std::lock_guard<std::mutex> guard(m_luaCallLock);
+    m_luaCallCosts.clear();
+}
+
+void TickProfiler::ReportSlowTick(uint64 us)
+{
+    ++m_slowTicks;
+
+    std::string phases;
+    char buf[128];
+    for (uint32 i = 0; i < MAX_TICK_PHASES; ++i)
+    {
+        uint64 phaseUs = m_tickPhaseTime[i].load(std::memory_order_relaxed);
+        if (phaseUs >= 1000)
+        {
+            snprintf(buf, sizeof(buf), " %s=%u", tickPhaseNames[i], uint32(phaseUs / 1000));
+            phases += buf;
+        }
+    }
+
+    uint64 worst = m_tickWorstOpcode.load(std::memory_order_relaxed);
+    uint16 worstOpcode = uint16(worst & 0xFFFF);
+
+    sLog.outError("Slow world tick: %u ms (threshold %u ms), phases (ms):%s", uint32(us / 1000), m_slowTickThreshold, phases.c_str());
+    if (worst)
+    {
+        sLog.outError("Slow world tick: most expensive opcode %s (0x%.4X) took %u us", LookupOpcodeName(worstOpcode), worstOpcode, uint32(worst >> 16));
+    }
+    sLog.outError("Slow world tick: db queue world %u, character %u, login %u", uint32(WorldDatabase.GetDelayQueueSize()),
+                  uint32(CharacterDatabase.GetDelayQueueSize()), uint32(LoginDatabase.GetDelayQueueSize()));
+}
+
+void TickProfiler::BuildReport(std::vector<std::string>& lines, uint32 topOpcodes) const
+{
+    char buf[256];
+
+    snprintf(buf, sizeof(buf), "World tick: count %u, avg %u us, p50 %u us, p95 %u us, p99 %u us, max %u us, slow %u",
+             uint32(m_worldTick.GetCount()), uint32(m_worldTick.GetAverage()), uint32(m_worldTick.GetPercentile(50)),
+             uint32(m_worldTick.GetPercentile(95)), uint32(m_worldTick.GetPercentile(99)), uint32(m_worldTick.GetMax()), uint32(m_slowTicks));
+    lines.push_back(buf);
+
+    snprintf(buf, sizeof(buf), "DB queue: world %u, character %u, login %u (max total %u)", uint32(WorldDatabase.GetDelayQueueSize()),
+             uint32(CharacterDatabase.GetDelayQueueSize()), uint32(LoginDatabase.GetDelayQueueSize()), uint32(m_maxDbQueue));
+    lines.push_back(buf);
+
+    for (uint32 i = 0; i < MAX_TICK_PHASES; ++i)
+    {
+        TickHistogram const& hist = m_phases[i];
+        if (!hist.GetCount())
+        {
+            continue;
+        }
+
+        snprintf(buf, sizeof(buf), "%-24s count %u, avg %u us, p95 %u us, max %u us", tickPhaseNames[i], uint32(hist.GetCount()),
+                 uint32(hist.GetAverage()), uint32(hist.GetPercentile(95)), uint32(hist.GetMax()));
+        lines.push_back(buf);
+    }
+
+    if (!topOpcodes)
+    {
+        return;
+    }
+
+    std::vector<std::pair<uint64, uint16> > opcodes;
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+    {
+        if (uint64 total = m_opcodes[i].total.load(std::memory_order_relaxed))
+        {
+            opcodes.push_back(std::make_pair(total, uint16(i)));
+        }
+    }
+
+    std::sort(opcodes.begin(), opcodes.end(), std::greater<std::pair<uint64, uint16> >());
+    if (opcodes.size() > topOpcodes)
+    {
+        opcodes.resize(topOpcodes);
+    }
+
+    for (std::vector<std::pair<uint64, uint16> >::const_iterator itr = opcodes.begin(); itr != opcodes.end(); ++itr)
+    {
+        OpcodeCost const& cost = m_opcodes[itr->second];
+        uint64 count = cost.count.load(std::memory_order_relaxed);
+        snprintf(buf, sizeof(buf), "%s: count %u, total %u ms, avg %u us, max %u us", LookupOpcodeName(itr->second), uint32(count),
+                 uint32(itr->first / 1000), uint32(count ? itr->first / count : 0), uint32(cost.max.load(std::memory_order_relaxed)));
+        lines.push_back(buf);
+    }
+
+    typedef std::pair<uint64, LuaCallCostMap::value_type const*> LuaCallEntry;
+
+    std::lock_guard<std::mutex> guard(m_luaCallLock);
+    std::vector<LuaCallEntry> luaCalls;
+    for (LuaCallCostMap::const_iterator itr = m_luaCallCosts.begin(); itr != m_luaCallCosts.end(); ++itr)
+    {
+        luaCalls.push_back(LuaCallEntry(itr->second.total, &*itr));
+    }
+
+    std::sort(luaCalls.begin(), luaCalls.end(), std::greater<LuaCallEntry>());
+    if (luaCalls.size() > topOpcodes)
+    {
+        luaCalls.resize(topOpcodes);
+    }
+
+    for (std::vector<LuaCallEntry>::const_iterator itr = luaCalls.begin(); itr != luaCalls.end(); ++itr)
+    {
+        LuaCallCost const& cost = itr->second->second;
+        snprintf(buf, sizeof(buf), "lua %s: count %u, total %u ms, avg %u us, max %u us", itr->second->first.c_str(), uint32(cost.count),
+                 uint32(cost.total / 1000), uint32(cost.total / cost.count), uint32(cost.max));
+        lines.push_back(buf);
+    }
+}
+
+void TickProfiler::WriteMetricsFile() const
+{
+    std::ofstream file(m_metricsFile.c_str(), std::ios::out | std::ios::trunc);
+    if (!file)
+    {
+        sLog.outError("TickProfiler: can't open metrics file %s", m_metricsFile.c_str());
+        return;
+    }
+
+    std::vector<std::string> lines;
+    BuildReport(lines, 25);
+
+    for (std::vector<std::string>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr)
+    {
+        file << *itr << "\n";
+    }
+}
+
+TickPhaseTimer::TickPhaseTimer() : m_enabled(sTickProfiler.IsEnabled()), m_phase(TICK_PHASE_NONE)
+{
+}
+
+void TickPhaseTimer::Start(TickProfilePhase phase)
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    TickProfiler::Clock::time_point now = TickProfiler::Clock::now();
+    if (m_phase != TICK_PHASE_NONE)
+    {
+        sTickProfiler.AddPhaseTime(m_phase, std::chrono::duration_cast<std::chrono::microseconds>(now - m_start).count());
+    }
+
+    m_phase = phase;
+    m_start = now;
+}
+
+void TickPhaseTimer::Stop()
+{
+    if (!m_enabled || m_phase == TICK_PHASE_NONE)
+    {
+        return;
+    }
+
+    sTickProfiler.AddPhaseTime(m_phase, TickProfiler::ElapsedUs(m_start));
+    m_phase = TICK_PHASE_NONE;
+}
@@ -0,0 +1,198 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef TICKPROFILER_H
+#define TICKPROFILER_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Phases of the world and map update loops that are timed separately.
+ * Map phases are summed over all maps (and all map update threads) of one world tick.
+ */
+enum TickProfilePhase
+{
+    TICK_PHASE_WORLD_MASSMAIL,
+    TICK_PHASE_WORLD_AUCTIONS,
+    TICK_PHASE_WORLD_AHBOT,
+    TICK_PHASE_WORLD_PLAYERBOTS,
+    TICK_PHASE_WORLD_SESSIONS,
+    TICK_PHASE_WORLD_MAPS,
+    TICK_PHASE_WORLD_BATTLEGROUNDS,
+    TICK_PHASE_WORLD_LFG,
+    TICK_PHASE_WORLD_OUTDOORPVP,
+    TICK_PHASE_WORLD_ELUNA,
+    TICK_PHASE_WORLD_DB_CALLBACKS,
+    TICK_PHASE_WORLD_GAME_EVENTS,
+    TICK_PHASE_WORLD_REMOVE_LIST,
+    TICK_PHASE_WORLD_PERSISTENT_STATES,
+    TICK_PHASE_WORLD_CLI,
+    TICK_PHASE_WORLD_TERRAIN,
+    TICK_PHASE_WORLD_MISC,
+
+    TICK_PHASE_MAP_SESSIONS,
+    TICK_PHASE_MAP_PLAYERS,
+    TICK_PHASE_MAP_CELLS,
+    TICK_PHASE_MAP_VISIBILITY,
+    TICK_PHASE_MAP_OBJECT_UPDATES,
+    TICK_PHASE_MAP_GRIDS,
+    TICK_PHASE_MAP_SCRIPTS,
+    TICK_PHASE_MAP_ELUNA,
+    TICK_PHASE_MAP_INSTANCE,
+
+    MAX_TICK_PHASES,
+    TICK_PHASE_NONE = MAX_TICK_PHASES
+};
+
+/**
+ * Lock free histogram of durations in microseconds, bucketed by powers of two.
+ * Bucket i holds samples in [2^(i-1), 2^i) us, the last bucket is open ended.
+ */
+class TickHistogram
+{
+    public:
+        static const uint32 BUCKET_COUNT = 24;
+
+        TickHistogram() { Reset(); }
+
+        void Add(uint64 us);
+        void Reset();
+
+        uint64 GetCount() const { return m_count.load(std::memory_order_relaxed); }
+        uint64 GetTotal() const { return m_total.load(std::memory_order_relaxed); }
+        uint64 GetMax() const { return m_max.load(std::memory_order_relaxed); }
+        uint64 GetAverage() const;
+        // upper bound of the bucket containing the requested percentile
+        uint64 GetPercentile(uint32 pct) const;
+
+    private:
+        std::atomic<uint64> m_buckets[BUCKET_COUNT];
+        std::atomic<uint64> m_count;
+        std::atomic<uint64> m_total;
+        std::atomic<uint64> m_max;
+};
+
+class TickProfiler
+{
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        TickProfiler();
+        ~TickProfiler();
+
+        void LoadFromConfig();
+
+        bool IsEnabled() const { return m_enabled; }
+        bool IsLuaProfilingEnabled() const { return m_enabled && m_luaCalls; }
+
+        void AddPhaseTime(TickProfilePhase phase, uint64 us);
+        void AddOpcodeTime(uint16 opcode, uint64 us);
+        // function is "script:line" of the called Lua function, time includes nested calls
+        void AddLuaCallTime(std::string const& function, uint64 us);
+
+        // called once at the end of World::Update with the wall time spent in it
+        void EndWorldTick(uint32 diff, uint64 us);
+
+        void Reset();
+
+        // human readable snapshot, used by the GM command and the metrics file
+        void BuildReport(std::vector<std::string>& lines, uint32 topOpcodes) const;
+
+        static uint64 ElapsedUs(Clock::time_point start) { return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count(); }
+
+    private:
+        struct OpcodeCost
+        {
+            std::atomic<uint64> count;
+            std::atomic<uint64> total;
+            std::atomic<uint64> max;
+        };
+
+        struct LuaCallCost
+        {
+            LuaCallCost() : count(0), total(0), max(0) {}
+
+            uint64 count;
+            uint64 total;
+            uint64 max;
+        };
+
+        typedef std::map<std::string, LuaCallCost> LuaCallCostMap;
+
+        void ReportSlowTick(uint64 us);
+        void WriteMetricsFile() const;
+
+        bool m_enabled;
+        bool m_luaCalls;
+        uint32 m_slowTickThreshold;                         // ms, 0 = disabled
+        uint32 m_metricsInterval;                           // ms
+        uint32 m_metricsTimer;
+        std::string m_metricsFile;
+
+        TickHistogram m_worldTick;
+        TickHistogram m_phases[MAX_TICK_PHASES];
+        OpcodeCost* m_opcodes;
+
+        // called from the world and all map threads
+        LuaCallCostMap m_luaCallCosts;
+        mutable std::mutex m_luaCallLock;
+
+        // current world tick only, reset by EndWorldTick
+        std::atomic<uint64> m_tickPhaseTime[MAX_TICK_PHASES];
+        std::atomic<uint64> m_tickWorstOpcode;              // (us << 16) | opcode
+
+        uint64 m_slowTicks;
+        size_t m_maxDbQueue;
+};
+
+/**
+ * Times consecutive phases of one update function. Starting a phase closes the
+ * previous one, so the update body only needs one call per phase boundary.
+ */
+class TickPhaseTimer
+{
+    public:
+        TickPhaseTimer();
+        ~TickPhaseTimer() { Stop(); }
+
+        void Start(TickProfilePhase phase);
+        void Stop();
+
+    private:
+        bool m_enabled;
+        TickProfilePhase m_phase;
+        TickProfiler::Clock::time_point m_start;
+};
+
+#define sTickProfiler MaNGOS::Singleton<TickProfiler>::Instance()
+
+#endif
@@ -71,6 +71,8 @@
 #include "GitRevision.h"
 #include "UpdateTime.h"
 #include "GameTime.h"
+#include "TickProfiler.h"
+#include "QueryOpcodeProcessor.h"
 
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
@@ -104,11 +106,16 @@ float World::m_MaxVisibleDistanceInInstances  = DEFAULT_VISIBILITY_INSTANCE;
 float World::m_MaxVisibleDistanceInBGArenas   = DEFAULT_VISIBILITY_BGARENAS;
 
 float World::m_MaxVisibleDistanceInFlight     = DEFAULT_VISIBILITY_DISTANCE;
+
+float World::m_InterestDistanceOnContinents   = 0.0f;
+float World::m_InterestDistanceInInstances    = 0.0f;
+float World::m_InterestDistanceInBGArenas     = 0.0f;
 float World::m_VisibleUnitGreyDistance        = 0;
 float World::m_VisibleObjectGreyDistance      = 0;
 
 float  World::m_relocation_lower_limit_sq     = 10.f * 10.f;
 uint32 World::m_relocation_ai_notify_delay    = 1000u;
+bool   World::m_visibility_update_deferred    = true;
 
 /// World constructor
 World::World()
@@ -186,6 +193,7 @@ World::~World()
 /// Cleanups before world stop
 void World::CleanupsBeforeStop()
 {
+    sQueryOpcodeProcessor.deactivate();              // no more packets handled outside the session update
     KickAll();                                       // save and kick all players
     UpdateSessions(1);                               // real players unload required UpdateSessions call
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
@@ -556,6 +564,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_UINT32_NUMTHREADS, "MapUpdateThreads", 2);
+    setConfig(CONFIG_UINT32_QUERY_THREADS, "QueryOpcodeThreads", 1);
 
     setConfigMin(CONFIG_UINT32_INTERVAL_MAPUPDATE, "MapUpdateInterval", 100, MIN_MAP_UPDATE_DELAY);
     if (reload)
@@ -564,6 +573,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_UINT32_INTERVAL_CHANGEWEATHER, "ChangeWeatherInterval", 10 * MINUTE * IN_MILLISECONDS);
+    setConfig(CONFIG_UINT32_INTERVAL_RESPAWN_SAVE, "RespawnTimeSaveInterval", 10 * IN_MILLISECONDS);
 
     if (configNoReload(reload, CONFIG_UINT32_PORT_WORLD, "WorldServerPort", DEFAULT_WORLDSERVER_PORT))
     {
@@ -674,9 +684,13 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_UINT32_GROUP_VISIBILITY, "Visibility.GroupMode", 0);
 
+    setConfig(CONFIG_BOOL_MOVEMENT_RELAY, "MovementRelay.Enable", false);
+    setConfig(CONFIG_UINT32_MOVEMENT_RELAY_WINDOW, "MovementRelay.Window", 100);
+
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    setConfigMin(CONFIG_UINT32_MASS_MAILER_OFFLINE_BATCH, "MassMailer.OfflineBatchSize", 500, 1);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -685,6 +699,8 @@ void World::LoadConfigSettings(bool reload)
         m_timers[WUPDATE_UPTIME].Reset();
     }
 
+    sTickProfiler.LoadFromConfig();
+
     setConfig(CONFIG_UINT32_SKILL_CHANCE_ORANGE, "SkillChance.Orange", 100);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_YELLOW, "SkillChance.Yellow", 75);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_GREEN,  "SkillChance.Green",  25);
@@ -719,6 +735,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_CHATFLOOD_MUTE_TIME,     "ChatFlood.MuteTime", 10);
 
     setConfig(CONFIG_BOOL_EVENT_ANNOUNCE, "Event.Announce", false);
+    setConfig(CONFIG_UINT32_GAME_EVENT_SPAWNS_PER_MAP_UPDATE, "GameEvent.SpawnsPerMapUpdate", 200);
 
     setConfig(CONFIG_UINT32_CREATURE_FAMILY_ASSISTANCE_DELAY, "CreatureFamilyAssistanceDelay", 1500);
     setConfig(CONFIG_UINT32_CREATURE_FAMILY_FLEE_DELAY,       "CreatureFamilyFleeDelay",       7000);
@@ -830,6 +847,7 @@ void World::LoadConfigSettings(bool reload)
 
     m_relocation_ai_notify_delay = sConfig.GetIntDefault("Visibility.AIRelocationNotifyDelay", 1000u);
     m_relocation_lower_limit_sq  = pow(sConfig.GetFloatDefault("Visibility.RelocationLowerLimit", 10), 2);
+    m_visibility_update_deferred = sConfig.GetBoolDefault("Visibility.DeferredUpdates", true);
 
     m_VisibleUnitGreyDistance = sConfig.GetFloatDefault("Visibility.Distance.Grey.Unit", 1);
     if (m_VisibleUnitGreyDistance >  MAX_VISIBILITY_DISTANCE)
@@ -890,6 +908,16 @@ void World::LoadConfigSettings(bool reload)
         m_MaxVisibleDistanceInFlight = MAX_VISIBILITY_DISTANCE - m_VisibleObjectGreyDistance;
     }
 
+    m_InterestDistanceOnContinents = sConfig.GetFloatDefault("Visibility.InterestDistance.Continents", 0.0f);
+    m_InterestDistanceInInstances  = sConfig.GetFloatDefault("Visibility.InterestDistance.Instances",  0.0f);
+    m_InterestDistanceInBGArenas   = sConfig.GetFloatDefault("Visibility.InterestDistance.BGArenas",   0.0f);
+    if (m_InterestDistanceOnContinents < 0.0f || m_InterestDistanceInInstances < 0.0f || m_InterestDistanceInBGArenas < 0.0f)
+    {
+        sLog.outError("Visibility.InterestDistance.* can't be negative, interest tiers disabled");
+        m_InterestDistanceOnContinents = m_InterestDistanceInInstances = m_InterestDistanceInBGArenas = 0.0f;
+    }
+    setConfigMin(CONFIG_UINT32_INTEREST_UPDATE_INTERVAL, "Visibility.InterestUpdateInterval", 500, 100);
+
     ///- Load the CharDelete related config options
     setConfigMinMax(CONFIG_UINT32_CHARDELETE_METHOD, "CharDelete.Method", 0, 0, 1);
     setConfigMinMax(CONFIG_UINT32_CHARDELETE_MIN_LEVEL, "CharDelete.MinLevel", 0, 0, getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL));
@@ -1529,6 +1557,22 @@ void World::SetInitialWorldSettings()
     sPlayerbotAIConfig.Initialize();
 #endif
 
+    ///- Start the query opcode threads, packet hooks of scripts and bots have to stay in the world thread
+    uint32 queryThreads = getConfig(CONFIG_UINT32_QUERY_THREADS);
+#ifdef ENABLE_ELUNA
+    if (GetEluna())
+    {
+        queryThreads = 0;
+    }
+#endif
+#ifdef ENABLE_PLAYERBOTS
+    queryThreads = 0;
+#endif
+    if (queryThreads > 0 && sQueryOpcodeProcessor.activate(queryThreads) == -1)
+    {
+        sLog.outError("Failed to start %u query opcode threads, query opcodes are processed in the world thread.", queryThreads);
+    }
+
     showFooter();
 
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
@@ -1674,6 +1718,9 @@ void World::DetectDBCLang()
 /// Update the World !
 void World::Update(uint32 diff)
 {
+    TickProfiler::Clock::time_point tickStart = TickProfiler::Clock::now();
+    TickPhaseTimer phaseTimer;
+
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
     {
@@ -1711,8 +1758,11 @@ void World::Update(uint32 diff)
     sWorldUpdateTime.UpdateWithDiff(diff);
 
     ///-Update mass mailer tasks if any
+    phaseTimer.Start(TICK_PHASE_WORLD_MASSMAIL);
     sMassMailMgr.Update();
 
+    phaseTimer.Start(TICK_PHASE_WORLD_AUCTIONS);
+
     /// <ul><li> Handle auctions when the timer has passed
     if (m_timers[WUPDATE_AUCTIONS].Passed())
     {
@@ -1731,6 +1781,7 @@ void World::Update(uint32 diff)
     }
 
     /// <li> Handle AHBot operations
+    phaseTimer.Start(TICK_PHASE_WORLD_AHBOT);
     if (m_timers[WUPDATE_AHBOT].Passed())
     {
         sAuctionBot.Update();
@@ -1738,14 +1789,17 @@ void World::Update(uint32 diff)
     }
 
 #ifdef ENABLE_PLAYERBOTS
+    phaseTimer.Start(TICK_PHASE_WORLD_PLAYERBOTS);
     sRandomPlayerbotMgr.UpdateAI(diff);
     sRandomPlayerbotMgr.UpdateSessions(diff);
 #endif
 
     /// <li> Handle session updates
+    phaseTimer.Start(TICK_PHASE_WORLD_SESSIONS);
     UpdateSessions(diff);
 
     /// <li> Update uptime table
+    phaseTimer.Start(TICK_PHASE_WORLD_MISC);
     if (m_timers[WUPDATE_UPTIME].Passed())
     {
         uint32 tmpDiff = uint32(m_gameTime - m_startTime);
@@ -1757,21 +1811,29 @@ void World::Update(uint32 diff)
 
     /// <li> Handle all other objects
     ///- Update objects (maps, transport, creatures,...)
+    phaseTimer.Start(TICK_PHASE_WORLD_MAPS);
     sMapMgr.Update(diff);
+    phaseTimer.Start(TICK_PHASE_WORLD_BATTLEGROUNDS);
     sBattleGroundMgr.Update(diff);
+    phaseTimer.Start(TICK_PHASE_WORLD_LFG);
     sLFGMgr.Update(diff);
+    phaseTimer.Start(TICK_PHASE_WORLD_OUTDOORPVP);
     sOutdoorPvPMgr.Update(diff);
 
     ///- Used by Eluna
 #ifdef ENABLE_ELUNA
+    phaseTimer.Start(TICK_PHASE_WORLD_ELUNA);
     if (Eluna* e = GetEluna())
     {
+        // hooks deferred by the map update threads
+        e->RunQueuedHooks();
         e->UpdateEluna(diff);
         e->OnWorldUpdate(diff);
     }
 #endif /* ENABLE_ELUNA */
 
     ///- Delete all characters which have been deleted X days before
+    phaseTimer.Start(TICK_PHASE_WORLD_MISC);
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
         m_timers[WUPDATE_DELETECHARS].Reset();
@@ -1779,8 +1841,11 @@ void World::Update(uint32 diff)
     }
 
     // execute callbacks from sql queries that were queued recently
+    phaseTimer.Start(TICK_PHASE_WORLD_DB_CALLBACKS);
     UpdateResultQueue();
 
+    phaseTimer.Start(TICK_PHASE_WORLD_MISC);
+
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
     {
@@ -1790,6 +1855,7 @@ void World::Update(uint32 diff)
     }
 
     ///- Process Game events when necessary
+    phaseTimer.Start(TICK_PHASE_WORLD_GAME_EVENTS);
     if (m_timers[WUPDATE_EVENTS].Passed())
     {
         m_timers[WUPDATE_EVENTS].Reset();                   // to give time for Update() to be processed
@@ -1800,11 +1866,15 @@ void World::Update(uint32 diff)
 
     /// </ul>
     ///- Move all creatures with "delayed move" and remove and delete all objects with "delayed remove"
+    phaseTimer.Start(TICK_PHASE_WORLD_REMOVE_LIST);
     sMapMgr.RemoveAllObjectsInRemoveList();
 
     // update the instance reset times
+    phaseTimer.Start(TICK_PHASE_WORLD_PERSISTENT_STATES);
     sMapPersistentStateMgr.Update();
 
+    phaseTimer.Start(TICK_PHASE_WORLD_MISC);
+
     if (m_MaintenanceTimeChecker < diff)
     {
         if (GetDateToday() >= m_NextMaintenanceDate)
@@ -1820,10 +1890,18 @@ void World::Update(uint32 diff)
     }
 
     // And last, but not least handle the issued cli commands
+    phaseTimer.Start(TICK_PHASE_WORLD_CLI);
     ProcessCliCommands();
 
     // cleanup unused GridMap objects as well as VMaps
+    phaseTimer.Start(TICK_PHASE_WORLD_TERRAIN);
     sTerrainMgr.Update(diff);
+    phaseTimer.Stop();
+
+    if (sTickProfiler.IsEnabled())
+    {
+        sTickProfiler.EndWorldTick(diff, TickProfiler::ElapsedUs(tickStart));
+    }
 }
 
 namespace MaNGOS
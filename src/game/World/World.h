@@ -87,6 +87,8 @@ enum eConfigUInt32Values
     CONFIG_UINT32_INTERVAL_GRIDCLEAN,
     CONFIG_UINT32_INTERVAL_MAPUPDATE,
     CONFIG_UINT32_INTERVAL_CHANGEWEATHER,
+    CONFIG_UINT32_INTERVAL_RESPAWN_SAVE,
+    CONFIG_UINT32_GAME_EVENT_SPAWNS_PER_MAP_UPDATE,
     CONFIG_UINT32_PORT_WORLD,
     CONFIG_UINT32_GAME_TYPE,
     CONFIG_UINT32_REALM_ZONE,
@@ -133,8 +135,11 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GM_INVISIBLE_AURA,
     CONFIG_UINT32_GM_MAX_SPEED_FACTOR,
     CONFIG_UINT32_GROUP_VISIBILITY,
+    CONFIG_UINT32_MOVEMENT_RELAY_WINDOW,
+    CONFIG_UINT32_INTEREST_UPDATE_INTERVAL,
     CONFIG_UINT32_MAIL_DELIVERY_DELAY,
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
+    CONFIG_UINT32_MASS_MAILER_OFFLINE_BATCH,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_RATE_MINING_LOWER,
@@ -184,6 +189,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_CHARDELETE_METHOD,
     CONFIG_UINT32_CHARDELETE_MIN_LEVEL,
     CONFIG_UINT32_NUMTHREADS,
+    CONFIG_UINT32_QUERY_THREADS,
     CONFIG_UINT32_GUID_RESERVE_SIZE_CREATURE,
     CONFIG_UINT32_GUID_RESERVE_SIZE_GAMEOBJECT,
     CONFIG_UINT32_CREATURE_RESPAWN_AGGRO_DELAY,
@@ -341,6 +347,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_OUTDOORPVP_SI_ENABLED,
     CONFIG_BOOL_OUTDOORPVP_EP_ENABLED,
     CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET,
+    CONFIG_BOOL_MOVEMENT_RELAY,
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
@@ -588,11 +595,16 @@ class World
         static float GetMaxVisibleDistanceInBGArenas()      { return m_MaxVisibleDistanceInBGArenas;   }
 
         static float GetMaxVisibleDistanceInFlight()        { return m_MaxVisibleDistanceInFlight;    }
+
+        static float GetInterestDistanceOnContinents()      { return m_InterestDistanceOnContinents;  }
+        static float GetInterestDistanceInInstances()       { return m_InterestDistanceInInstances;   }
+        static float GetInterestDistanceInBGArenas()        { return m_InterestDistanceInBGArenas;    }
         static float GetVisibleUnitGreyDistance()           { return m_VisibleUnitGreyDistance;       }
         static float GetVisibleObjectGreyDistance()         { return m_VisibleObjectGreyDistance;     }
 
         static float GetRelocationLowerLimitSq()            { return m_relocation_lower_limit_sq; }
         static uint32 GetRelocationAINotifyDelay()          { return m_relocation_ai_notify_delay; }
+        static bool IsVisibilityUpdateDeferred()            { return m_visibility_update_deferred; }
 
         void InitServerMaintenanceCheck();
         void ServerMaintenanceStart();
@@ -700,11 +712,16 @@ class World
         static float m_MaxVisibleDistanceInBGArenas;
 
         static float m_MaxVisibleDistanceInFlight;
+
+        static float m_InterestDistanceOnContinents;
+        static float m_InterestDistanceInInstances;
+        static float m_InterestDistanceInBGArenas;
         static float m_VisibleUnitGreyDistance;
         static float m_VisibleObjectGreyDistance;
 
         static float  m_relocation_lower_limit_sq;
         static uint32 m_relocation_ai_notify_delay;
+        static bool   m_visibility_update_deferred;
 
         // CLI command holder to be thread safe
         ACE_Based::LockedQueue<CliCommandHolder*, ACE_Thread_Mutex> cliCmdQueue;
@@ -123,6 +123,11 @@ void AhBot::Init()
 
     availableItems.Init();
 
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+        LoadHistory();
+    }
+
     sLog.outString("AhBot configuration loaded");
 }
 
@@ -445,8 +450,7 @@ int AhBot::Answer(int auction, Category* category, ItemBag* inAuctionItems)
             AddToHistory(entry, AHBOT_WON_BID);
         }
 
-        CharacterDatabase.PExecute("DELETE FROM `ahbot_history` WHERE `item` = '%u' AND `won` = 4 AND `auction_house` = '%u' ",
-                proto->ItemId, factions[auctionIds[auction]]);
+        ClearItemDelay(proto->ItemId, auctionIds[auction]);
 
         answered++;
     }
@@ -456,30 +460,64 @@ int AhBot::Answer(int auction, Category* category, ItemBag* inAuctionItems)
 
 uint32 AhBot::GetTime(string category, uint32 id, uint32 auctionHouse, uint32 type)
 {
-    QueryResult* results = CharacterDatabase.PQuery("SELECT MAX(`buytime`) FROM `ahbot_history` WHERE `item` = '%u' AND `won` = '%u' AND `auction_house` = '%u' AND `category` = '%s'",
-        id, type, factions[auctionHouse], category.c_str());
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+    LoadHistory();
 
-    if (!results)
+    AuctionHistory& ahHistory = history[factions[auctionHouse]];
+    HistoryRecords::const_iterator i = ahHistory.records.find(HistoryKey(type, id, category));
+    if (i == ahHistory.records.end())
     {
         return 0;
     }
 
-    Field* fields = results->Fetch();
-    uint32 result = fields[0].GetUInt32();
-    delete results;
+    uint32 result = 0;
+    for (vector<HistoryEntry>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+    {
+        result = max(result, j->buytime);
+    }
 
     return result;
 }
 
 void AhBot::SetTime(string category, uint32 id, uint32 auctionHouse, uint32 type, uint32 value)
 {
+    ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+    LoadHistory();
+
+    uint32 faction = factions[auctionHouse];
+    AuctionHistory& ahHistory = history[faction];
+    HistoryKey key(type, id, category);
+    HistoryRecords::iterator i = ahHistory.records.find(key);
+    if (i != ahHistory.records.end())
+    {
+        RemoveHistoryEntries(ahHistory, i);
+    }
+    AddHistoryEntry(ahHistory, key, value, 0);
+
     CharacterDatabase.PExecute("DELETE FROM `ahbot_history` WHERE `item` = '%u' AND `won` = '%u' AND `auction_house` = '%u' AND `category` = '%s'",
-        id, type, factions[auctionHouse], category.c_str());
+        id, type, faction, category.c_str());
 
     CharacterDatabase.PExecute("INSERT INTO `ahbot_history` (`buytime`, `item`, `bid`, `buyout`, `category`, `won`, `auction_house`) "
         "VALUES ('%u', '%u', '%u', '%u', '%s', '%u', '%u')",
         value, id, 0, 0,
-        category.c_str(), type, factions[auctionHouse]);
+        category.c_str(), type, faction);
+}
+
+void AhBot::ClearItemDelay(uint32 itemId, uint32 auctionHouse)
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+    LoadHistory();
+
+    uint32 faction = factions[auctionHouse];
+    AuctionHistory& ahHistory = history[faction];
+    HistoryRecords::iterator i = ahHistory.records.lower_bound(HistoryKey(AHBOT_WON_DELAY, itemId, ""));
+    while (i != ahHistory.records.end() && i->first.won == AHBOT_WON_DELAY && i->first.item == itemId)
+    {
+        RemoveHistoryEntries(ahHistory, i++);
+    }
+
+    CharacterDatabase.PExecute("DELETE FROM `ahbot_history` WHERE `item` = '%u' AND `won` = 4 AND `auction_house` = '%u' ",
+            itemId, faction);
 }
 
 uint32 AhBot::GetBuyTime(uint32 entry, uint32 itemId, uint32 auctionHouse, Category*& category, double priceLevel)
@@ -863,28 +901,42 @@ void AhBot::AddToHistory(AuctionEntry* entry, uint32 won)
     updateMarketPrice(proto->ItemId, entry->buyout / count, entry->auctionHouseEntry->houseId);
 
     uint32 now = time(0);
+    uint32 bid = entry->bid ? entry->bid : entry->startbid;
+
+    ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+    LoadHistory();
+
+    uint32 faction = factions[entry->auctionHouseEntry->houseId];
+    AddHistoryEntry(history[faction], HistoryKey(won, entry->itemTemplate, category), now, bid);
+
     CharacterDatabase.PExecute("INSERT INTO `ahbot_history` (`buytime`, `item`, `bid`, `buyout`, `category`, `won`, `auction_house`) "
         "VALUES ('%u', '%u', '%u', '%u', '%s', '%u', '%u')",
-        now, entry->itemTemplate, entry->bid ? entry->bid : entry->startbid, entry->buyout,
-        category.c_str(), won, factions[entry->auctionHouseEntry->houseId]);
+        now, entry->itemTemplate, bid, entry->buyout,
+        category.c_str(), won, faction);
 }
 
 uint32 AhBot::GetAnswerCount(uint32 itemId, uint32 auctionHouse, uint32 withinTime)
 {
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+    LoadHistory();
+
+    uint32 since = time(0) - withinTime;
     uint32 count = 0;
 
-    QueryResult* results = CharacterDatabase.PQuery("SELECT COUNT(*) FROM `ahbot_history` WHERE "
-        "`item` = '%u' AND `won` in (2, 3) AND `auction_house` = '%u' AND `buytime` > '%u'",
-        itemId, factions[auctionHouse], time(0) - withinTime);
-    if (results)
+    AuctionHistory& ahHistory = history[factions[auctionHouse]];
+    for (uint32 won = AHBOT_WON_SELF; won <= AHBOT_WON_BID; ++won)
     {
-        do
+        HistoryRecords::const_iterator i = ahHistory.records.lower_bound(HistoryKey(won, itemId, ""));
+        for (; i != ahHistory.records.end() && i->first.won == won && i->first.item == itemId; ++i)
         {
-            Field* fields = results->Fetch();
-            count = fields[0].GetUInt32();
-        } while (results->NextRow());
-
-        delete results;
+            for (vector<HistoryEntry>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+            {
+                if (j->buytime > since)
+                {
+                    count++;
+                }
+            }
+        }
     }
 
     return count;
@@ -893,6 +945,39 @@ uint32 AhBot::GetAnswerCount(uint32 itemId, uint32 auctionHouse, uint32 withinTi
 void AhBot::CleanupHistory()
 {
     uint32 when = time(0) - 3600 * 24 * sAhBotConfig.historyDays;
+
+    ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+    LoadHistory();
+
+    for (map<uint32, AuctionHistory>::iterator h = history.begin(); h != history.end(); ++h)
+    {
+        HistoryRecords& records = h->second.records;
+        for (HistoryRecords::iterator i = records.begin(); i != records.end();)
+        {
+            vector<HistoryEntry>& entries = i->second;
+            size_t kept = 0;
+            for (size_t j = 0; j < entries.size(); ++j)
+            {
+                if (entries[j].buytime >= when)
+                {
+                    entries[kept++] = entries[j];
+                }
+            }
+            entries.resize(kept);
+
+            if (entries.empty())
+            {
+                records.erase(i++);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        RebuildHistoryIndex(h->second);
+    }
+
     CharacterDatabase.PExecute("DELETE FROM `ahbot_history` WHERE `buytime` < '%u'", when);
 }
 
@@ -900,42 +985,25 @@ uint32 AhBot::GetAvailableMoney(uint32 auctionHouse)
 {
     int64 result = sAhBotConfig.alwaysAvailableMoney;
 
-    map<uint32, uint32> data;
-    data[AHBOT_WON_PLAYER] = 0;
-    data[AHBOT_WON_SELF] = 0;
-
-    const AuctionHouseEntry* ahEntry = sAuctionHouseStore.LookupEntry(auctionHouse);
-    QueryResult* results = CharacterDatabase.PQuery(
-        "SELECT `won`, SUM(`bid`) FROM `ahbot_history` WHERE `auction_house` = '%u' GROUP BY `won` HAVING `won` > 0 ORDER BY `won`",
-        factions[auctionHouse]);
-    if (results)
+    int64 playerBids = 0, selfBids = 0;
+    uint32 lastBuyTime = 0;
     {
-        do
-        {
-            Field* fields = results->Fetch();
-            data[fields[0].GetUInt32()] = fields[1].GetUInt32();
-
-        } while (results->NextRow());
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+        LoadHistory();
 
-        delete results;
+        AuctionHistory& ahHistory = history[factions[auctionHouse]];
+        playerBids = (int64)ahHistory.bidSums[AHBOT_WON_PLAYER];
+        selfBids = (int64)ahHistory.bidSums[AHBOT_WON_SELF];
+        lastBuyTime = ahHistory.lastSelfBuyTime;
     }
 
-    results = CharacterDatabase.PQuery(
-        "SELECT max(`buytime`) FROM `ahbot_history` WHERE `auction_house` = '%u' AND `won` = '2'",
-        factions[auctionHouse]);
-    if (results)
+    uint32 now = time(0);
+    if (lastBuyTime && now > lastBuyTime)
     {
-        Field* fields = results->Fetch();
-        uint32 lastBuyTime = fields[0].GetUInt32();
-        uint32 now = time(0);
-        if (lastBuyTime && now > lastBuyTime)
-        {
-            result += (now - lastBuyTime) / 3600 / 24 * sAhBotConfig.alwaysAvailableMoney;
-        }
-
-        delete results;
+        result += (now - lastBuyTime) / 3600 / 24 * sAhBotConfig.alwaysAvailableMoney;
     }
 
+    const AuctionHouseEntry* ahEntry = sAuctionHouseStore.LookupEntry(auctionHouse);
     AuctionHouseObject::AuctionEntryMap const& auctionEntryMap = sAuctionMgr.GetAuctionsMap(ahEntry)->GetAuctions();
     for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = auctionEntryMap.begin(); itr != auctionEntryMap.end(); ++itr)
     {
@@ -948,7 +1016,7 @@ uint32 AhBot::GetAvailableMoney(uint32 auctionHouse)
         result -= entry->bid;
     }
 
-    result += (data[AHBOT_WON_PLAYER] - data[AHBOT_WON_SELF]);
+    result += playerBids - selfBids;
     return result < 0 ? 0 : (uint32)result;
 }
 
@@ -991,15 +1059,10 @@ void AhBot::CheckCategoryMultipliers()
 
 void AhBot::updateMarketPrice(uint32 itemId, double price, uint32 auctionHouse)
 {
-    double marketPrice = 0;
-
-    QueryResult* results = CharacterDatabase.PQuery("SELECT `price` FROM `ahbot_price` WHERE `item` = '%u' AND `auction_house` = '%u'", itemId, auctionHouse);
-    if (results)
-    {
-        marketPrice = results->Fetch()[0].GetFloat();
-        delete results;
-    }
+    ACE_GUARD(ACE_Thread_Mutex, guard, historyLock);
+    LoadHistory();
 
+    double& marketPrice = marketPrices[make_pair(itemId, auctionHouse)];
     if (marketPrice > 0)
     {
         marketPrice = (marketPrice + price) / 2;
@@ -1013,6 +1076,153 @@ void AhBot::updateMarketPrice(uint32 itemId, double price, uint32 auctionHouse)
     CharacterDatabase.PExecute("INSERT INTO `ahbot_price` (`item`, `price`, `auction_house`) VALUES ('%u', '%lf', '%u')", itemId, marketPrice, auctionHouse);
 }
 
+double AhBot::GetMarketPrice(uint32 itemId, uint32 auctionHouse)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+    LoadHistory();
+
+    map<pair<uint32, uint32>, double>::const_iterator i = marketPrices.find(make_pair(itemId, auctionHouse));
+    return i != marketPrices.end() ? i->second : 0;
+}
+
+uint32 AhBot::GetItemWonPeriodCount(uint32 itemId, uint32 untilTime, uint32 auctionHouse)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+    LoadHistory();
+
+    AuctionHistory& ahHistory = history[factions[auctionHouse]];
+    map<uint32, WonPeriods>::const_iterator i = ahHistory.itemWonPeriods.find(itemId);
+    return i != ahHistory.itemWonPeriods.end() ? CountWonPeriods(i->second, untilTime) : 0;
+}
+
+uint32 AhBot::GetCategoryWonPeriodCount(string const& category, uint32 untilTime, uint32 auctionHouse)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, historyLock, 0);
+    LoadHistory();
+
+    AuctionHistory& ahHistory = history[factions[auctionHouse]];
+    map<string, WonPeriods>::const_iterator i = ahHistory.categoryWonPeriods.find(category);
+    return i != ahHistory.categoryWonPeriods.end() ? CountWonPeriods(i->second, untilTime) : 0;
+}
+
+void AhBot::LoadHistory()
+{
+    if (historyLoaded)
+    {
+        return;
+    }
+
+    historyLoaded = true;
+
+    uint32 count = 0;
+    QueryResult* results = CharacterDatabase.Query("SELECT `buytime`, `item`, `bid`, `category`, `won`, `auction_house` FROM `ahbot_history`");
+    if (results)
+    {
+        do
+        {
+            Field* fields = results->Fetch();
+            HistoryKey key(fields[4].GetUInt32(), fields[1].GetUInt32(), fields[3].GetCppString());
+            AddHistoryEntry(history[fields[5].GetUInt32()], key, fields[0].GetUInt32(), fields[2].GetUInt32());
+            count++;
+        } while (results->NextRow());
+
+        delete results;
+    }
+
+    results = CharacterDatabase.Query("SELECT `item`, `auction_house`, `price` FROM `ahbot_price`");
+    if (results)
+    {
+        do
+        {
+            Field* fields = results->Fetch();
+            marketPrices[make_pair(fields[0].GetUInt32(), fields[1].GetUInt32())] = fields[2].GetFloat();
+        } while (results->NextRow());
+
+        delete results;
+    }
+
+    sLog.outDetail("AhBot history loaded: %u records, %u market prices", count, (uint32)marketPrices.size());
+}
+
+void AhBot::AddHistoryEntry(AuctionHistory& ahHistory, HistoryKey const& key, uint32 buytime, uint32 bid)
+{
+    HistoryEntry entry;
+    entry.buytime = buytime;
+    entry.bid = bid;
+
+    ahHistory.records[key].push_back(entry);
+    IndexHistoryEntry(ahHistory, key, entry);
+}
+
+static void AddWonPeriod(map<int64, uint32>& periods, uint32 buytime)
+{
+    // same grouping as ROUND(`buytime`/3600/24/5)
+    int64 period = (int64)floor(buytime / 432000.0 + 0.5);
+
+    map<int64, uint32>::iterator i = periods.find(period);
+    if (i == periods.end() || buytime < i->second)
+    {
+        periods[period] = buytime;
+    }
+}
+
+void AhBot::IndexHistoryEntry(AuctionHistory& ahHistory, HistoryKey const& key, HistoryEntry const& entry)
+{
+    ahHistory.bidSums[key.won] += entry.bid;
+
+    if (key.won == AHBOT_WON_SELF && entry.buytime > ahHistory.lastSelfBuyTime)
+    {
+        ahHistory.lastSelfBuyTime = entry.buytime;
+    }
+
+    if (key.won == AHBOT_WON_PLAYER)
+    {
+        AddWonPeriod(ahHistory.itemWonPeriods[key.item], entry.buytime);
+        AddWonPeriod(ahHistory.categoryWonPeriods[key.category], entry.buytime);
+    }
+}
+
+void AhBot::RemoveHistoryEntries(AuctionHistory& ahHistory, HistoryRecords::iterator i)
+{
+    // only used for the delay records, player purchases leave through CleanupHistory
+    for (vector<HistoryEntry>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+    {
+        ahHistory.bidSums[i->first.won] -= j->bid;
+    }
+
+    ahHistory.records.erase(i);
+}
+
+void AhBot::RebuildHistoryIndex(AuctionHistory& ahHistory)
+{
+    ahHistory.bidSums.clear();
+    ahHistory.lastSelfBuyTime = 0;
+    ahHistory.itemWonPeriods.clear();
+    ahHistory.categoryWonPeriods.clear();
+
+    for (HistoryRecords::const_iterator i = ahHistory.records.begin(); i != ahHistory.records.end(); ++i)
+    {
+        for (vector<HistoryEntry>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+        {
+            IndexHistoryEntry(ahHistory, i->first, *j);
+        }
+    }
+}
+
+uint32 AhBot::CountWonPeriods(WonPeriods const& periods, uint32 untilTime)
+{
+    uint32 count = 0;
+    for (WonPeriods::const_iterator i = periods.begin(); i != periods.end(); ++i)
+    {
+        if (i->second <= untilTime)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
 bool AhBot::IsBotAuction(uint32 bidder)
 {
     return allBidders.find(bidder) != allBidders.end();
@@ -1032,31 +1242,33 @@ uint32 AhBot::GetRandomBidder(uint32 auctionHouse)
 
 void AhBot::LoadRandomBots()
 {
-    for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); i++)
+    if (!sPlayerbotAIConfig.randomBotAccounts.empty())
     {
-        uint32 accountId = *i;
-        if (!sAccountMgr.GetCharactersCount(accountId))
+        ostringstream accounts;
+        for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); i++)
         {
-            continue;
+            if (i != sPlayerbotAIConfig.randomBotAccounts.begin())
+            {
+                accounts << ",";
+            }
+            accounts << *i;
         }
 
-        QueryResult *result = CharacterDatabase.PQuery("SELECT `guid`, `race` FROM `characters` WHERE `account` = '%u'", accountId);
-        if (!result)
+        QueryResult *result = CharacterDatabase.PQuery("SELECT `guid`, `race` FROM `characters` WHERE `account` IN (%s)", accounts.str().c_str());
+        if (result)
         {
-            continue;
+            do
+            {
+                Field* fields = result->Fetch();
+                uint32 guid = fields[0].GetUInt32();
+                uint32 race = fields[1].GetUInt32();
+                uint32 auctionHouse = PlayerbotAI::IsOpposing(race, RACE_HUMAN) ? 2 : 1;
+                bidders[auctionHouse].push_back(guid);
+                bidders[3].push_back(guid);
+                allBidders.insert(guid);
+            } while (result->NextRow());
+            delete result;
         }
-
-        do
-        {
-            Field* fields = result->Fetch();
-            uint32 guid = fields[0].GetUInt32();
-            uint32 race = fields[1].GetUInt32();
-            uint32 auctionHouse = PlayerbotAI::IsOpposing(race, RACE_HUMAN) ? 2 : 1;
-            bidders[auctionHouse].push_back(guid);
-            bidders[3].push_back(guid);
-            allBidders.insert(guid);
-        } while (result->NextRow());
-        delete result;
     }
 
     if (allBidders.empty() && sAhBotConfig.guid)
@@ -29,6 +29,7 @@
 #include "../AuctionHouse/AuctionHouseMgr.h"
 #include "ObjectGuid.h"
 #include "WorldSession.h"
+#include <ace/Thread_Mutex.h>
 
 #define MAX_AUCTIONS 3
 #define AHBOT_WON_EXPIRE 0
@@ -45,7 +46,7 @@ namespace ahbot
     class AhBot
     {
     public:
-        AhBot() : nextAICheckTime(0), updating(false) {}
+        AhBot() : nextAICheckTime(0), updating(false), historyLoaded(false) {}
         virtual ~AhBot();
 
     public:
@@ -66,7 +67,64 @@ namespace ahbot
         int32 GetBuyPrice(const ItemPrototype* proto);
         double GetRarityPriceMultiplier(const ItemPrototype* proto);
 
+        // read by the pricing strategies, possibly from map update threads
+        double GetMarketPrice(uint32 itemId, uint32 auctionHouse);
+        uint32 GetItemWonPeriodCount(uint32 itemId, uint32 untilTime, uint32 auctionHouse);
+        uint32 GetCategoryWonPeriodCount(string const& category, uint32 untilTime, uint32 auctionHouse);
+
     private:
+        // ahbot_history is kept in memory and only written behind
+        struct HistoryKey
+        {
+            HistoryKey(uint32 won, uint32 item, string const& category) : won(won), item(item), category(category) {}
+
+            bool operator<(HistoryKey const& other) const
+            {
+                if (won != other.won)
+                {
+                    return won < other.won;
+                }
+                if (item != other.item)
+                {
+                    return item < other.item;
+                }
+                return category < other.category;
+            }
+
+            uint32 won;
+            uint32 item;
+            string category;
+        };
+
+        struct HistoryEntry
+        {
+            uint32 buytime;
+            uint32 bid;
+        };
+
+        // earliest buy time of each five day period with a player purchase
+        typedef map<int64, uint32> WonPeriods;
+        typedef map<HistoryKey, vector<HistoryEntry> > HistoryRecords;
+
+        struct AuctionHistory
+        {
+            AuctionHistory() : lastSelfBuyTime(0) {}
+
+            HistoryRecords records;
+            map<uint32, uint64> bidSums;
+            uint32 lastSelfBuyTime;
+            map<uint32, WonPeriods> itemWonPeriods;
+            map<string, WonPeriods> categoryWonPeriods;
+        };
+
+        void LoadHistory();
+        void ClearItemDelay(uint32 itemId, uint32 auctionHouse);
+        static void AddHistoryEntry(AuctionHistory& ahHistory, HistoryKey const& key, uint32 buytime, uint32 bid);
+        static void IndexHistoryEntry(AuctionHistory& ahHistory, HistoryKey const& key, HistoryEntry const& entry);
+        static void RemoveHistoryEntries(AuctionHistory& ahHistory, HistoryRecords::iterator i);
+        static void RebuildHistoryIndex(AuctionHistory& ahHistory);
+        static uint32 CountWonPeriods(WonPeriods const& periods, uint32 untilTime);
+
         int Answer(int auction, Category* category, ItemBag* inAuctionItems);
         int AddAuctions(int auction, Category* category, ItemBag* inAuctionItems);
         int AddAuction(int auction, Category* category, const ItemPrototype* proto);
@@ -104,6 +162,11 @@ namespace ahbot
         map<uint32, vector<uint32> > bidders;
         set<uint32> allBidders;
         bool updating;
+
+        ACE_Thread_Mutex historyLock;
+        bool historyLoaded;
+        map<uint32, AuctionHistory> history;                // by auction house faction
+        map<pair<uint32, uint32>, double> marketPrices;     // by item and auction house
     };
 };
 
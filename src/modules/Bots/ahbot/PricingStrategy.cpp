@@ -22,16 +22,7 @@ uint32 PricingStrategy::GetSellPrice(ItemPrototype const* proto, uint32 auctionH
 
 double PricingStrategy::GetMarketPrice(uint32 itemId, uint32 auctionHouse)
 {
-    double marketPrice = 0;
-
-    QueryResult* results = CharacterDatabase.PQuery("SELECT `price` FROM `ahbot_price` WHERE `item` = '%u' AND `auction_house` = '%u'", itemId, auctionHouse);
-    if (results)
-    {
-        marketPrice = results->Fetch()[0].GetFloat();
-        delete results;
-    }
-
-    return marketPrice;
+    return auctionbot.GetMarketPrice(itemId, auctionHouse);
 }
 
 uint32 PricingStrategy::GetBuyPrice(ItemPrototype const* proto, uint32 auctionHouse)
@@ -93,6 +84,15 @@ string PricingStrategy::ExplainBuyPrice(ItemPrototype const* proto, uint32 aucti
 
 double PricingStrategy::GetRarityPriceMultiplier(uint32 itemId)
 {
+    {
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, cacheLock, 1.0);
+        map<uint32, double>::const_iterator i = rarityMultipliers.find(itemId);
+        if (i != rarityMultipliers.end())
+        {
+            return i->second;
+        }
+    }
+
     double result = 1.0;
 
     QueryResult* results = WorldDatabase.PQuery(
@@ -125,31 +125,17 @@ double PricingStrategy::GetRarityPriceMultiplier(uint32 itemId)
         delete results;
     }
 
-    return result >= 1.0 ? result : 1.0;
+    result = result >= 1.0 ? result : 1.0;
+
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, cacheLock, result);
+    rarityMultipliers[itemId] = result;
+    return result;
 }
 
 
 double PricingStrategy::GetCategoryPriceMultiplier(uint32 untilTime, uint32 auctionHouse)
 {
-    double result = 1.0;
-
-    QueryResult* results = CharacterDatabase.PQuery(
-        "SELECT COUNT(*) FROM (SELECT ROUND(`buytime`/3600/24/5) AS days FROM `ahbot_history` WHERE `category` = '%s' AND `won` = '1' AND `buytime` <= '%u' AND `auction_house` = '%u' GROUP BY `days`) q",
-        category->GetName().c_str(), untilTime, AhBot::factions[auctionHouse]);
-    if (results)
-    {
-        Field* fields = results->Fetch();
-        uint32 count = fields[0].GetUInt32();
-
-        if (count)
-        {
-            result += count;
-        }
-
-        delete results;
-    }
-
-    return result;
+    return 1.0 + auctionbot.GetCategoryWonPeriodCount(category->GetName(), untilTime, auctionHouse);
 }
 
 double PricingStrategy::GetMultiplier(double count, double firstBuyTime, double lastBuyTime)
@@ -161,25 +147,7 @@ double PricingStrategy::GetMultiplier(double count, double firstBuyTime, double
 
 double PricingStrategy::GetItemPriceMultiplier(ItemPrototype const* proto, uint32 untilTime, uint32 auctionHouse)
 {
-    double result = 1.0;
-
-    QueryResult* results = CharacterDatabase.PQuery(
-        "SELECT count(*) FROM (SELECT ROUND(`buytime`/3600/24/5) AS `days` FROM `ahbot_history` WHERE `won` = '1' AND `item` = '%u' AND `buytime` <= '%u' AND `auction_house` = '%u' GROUP BY `days`) q",
-        proto->ItemId, untilTime, AhBot::factions[auctionHouse]);
-    if (results)
-    {
-        Field* fields = results->Fetch();
-        uint32 count = fields[0].GetUInt32();
-
-        if (count)
-        {
-            result += count;
-        }
-
-        delete results;
-    }
-
-    return result;
+    return 1.0 + auctionbot.GetItemWonPeriodCount(proto->ItemId, untilTime, auctionHouse);
 }
 
 uint32 PricingStrategy::ApplyQualityMultiplier(ItemPrototype const* proto, uint32 price)
@@ -208,17 +176,7 @@ uint32 PricingStrategy::GetDefaultBuyPrice(ItemPrototype const* proto)
     uint32 level = max(proto->ItemLevel, proto->RequiredLevel);
     if (proto->Class == ITEM_CLASS_QUEST)
     {
-        double result = 1.0;
-
-        QueryResult* results = WorldDatabase.PQuery(
-            "SELECT MAX(`QuestLevel`), MAX(`MinLevel`) FROM `quest_template` WHERE `ReqItemId1` = %u OR `ReqItemId2` = %u OR `ReqItemId3` = %u OR `ReqItemId4` = %u",
-            proto->ItemId, proto->ItemId, proto->ItemId, proto->ItemId);
-        if (results)
-        {
-            Field* fields = results->Fetch();
-            level = max(fields[0].GetUInt32(), fields[1].GetUInt32());
-            delete results;
-        }
+        level = GetQuestItemLevel(proto->ItemId, level);
     }
     price = max(price, sAhBotConfig.defaultMinPrice * level * level / 10);
     price = max(price, (uint32)100);
@@ -226,6 +184,34 @@ uint32 PricingStrategy::GetDefaultBuyPrice(ItemPrototype const* proto)
     return ApplyQualityMultiplier(proto, price) * sAhBotConfig.priceMultiplier;
 }
 
+uint32 PricingStrategy::GetQuestItemLevel(uint32 itemId, uint32 defaultLevel)
+{
+    {
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, cacheLock, defaultLevel);
+        map<uint32, uint32>::const_iterator i = questItemLevels.find(itemId);
+        if (i != questItemLevels.end())
+        {
+            return i->second;
+        }
+    }
+
+    uint32 level = defaultLevel;
+
+    QueryResult* results = WorldDatabase.PQuery(
+        "SELECT MAX(`QuestLevel`), MAX(`MinLevel`) FROM `quest_template` WHERE `ReqItemId1` = %u OR `ReqItemId2` = %u OR `ReqItemId3` = %u OR `ReqItemId4` = %u",
+        itemId, itemId, itemId, itemId);
+    if (results)
+    {
+        Field* fields = results->Fetch();
+        level = max(fields[0].GetUInt32(), fields[1].GetUInt32());
+        delete results;
+    }
+
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, cacheLock, level);
+    questItemLevels[itemId] = level;
+    return level;
+}
+
 uint32 PricingStrategy::GetDefaultSellPrice(ItemPrototype const* proto)
 {
     return GetDefaultBuyPrice(proto);
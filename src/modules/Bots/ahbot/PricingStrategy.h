@@ -1,6 +1,7 @@
 #pragma once
 #include "Config.h"
 #include "ItemPrototype.h"
+#include <ace/Thread_Mutex.h>
 
 using namespace std;
 
@@ -28,9 +29,16 @@ namespace ahbot
         virtual double GetItemPriceMultiplier(ItemPrototype const* proto, uint32 untilTime, uint32 auctionHouse);
         double GetMultiplier(double count, double firstBuyTime, double lastBuyTime);
         double GetMarketPrice(uint32 itemId, uint32 auctionHouse);
+        uint32 GetQuestItemLevel(uint32 itemId, uint32 defaultLevel);
 
     protected:
         Category* category;
+
+    private:
+        // world data does not change while running, look it up once per item
+        ACE_Thread_Mutex cacheLock;
+        map<uint32, double> rarityMultipliers;
+        map<uint32, uint32> questItemLevels;
     };
 
     class BuyOnlyRarePricingStrategy : public PricingStrategy
@@ -77,7 +77,8 @@ void PacketHandlingHelper::AddPacket(const WorldPacket& packet)
  * Default constructor for PlayerbotAI.
  */
 PlayerbotAI::PlayerbotAI() : PlayerbotAIBase(), bot(NULL), aiObjectContext(NULL),
-    currentEngine(NULL), chatHelper(this), chatFilter(this), accountId(0), security(NULL), master(NULL), currentState(BOT_STATE_NON_COMBAT)
+    currentEngine(NULL), chatHelper(this), chatFilter(this), accountId(0), security(NULL), master(NULL), currentState(BOT_STATE_NON_COMBAT),
+    lastRealPlayerCheck(0), realPlayerNearby(true), deferredThinks(0)
 {
     for (int i = 0 ; i < BOT_STATE_MAX; i++)
     {
@@ -90,7 +91,8 @@ PlayerbotAI::PlayerbotAI() : PlayerbotAIBase(), bot(NULL), aiObjectContext(NULL)
  * @param bot The player bot.
  */
 PlayerbotAI::PlayerbotAI(Player* bot) :
-    PlayerbotAIBase(), chatHelper(this), chatFilter(this), security(bot), master(NULL)
+    PlayerbotAIBase(), chatHelper(this), chatFilter(this), security(bot), master(NULL),
+    lastRealPlayerCheck(0), realPlayerNearby(true), deferredThinks(0)
 {
     this->bot = bot;
 
@@ -184,7 +186,73 @@ void PlayerbotAI::UpdateAI(uint32 elapsed)
         nextAICheckDelay = sPlayerbotAIConfig.maxWaitForMove;
     }
 
+    // Bots commanded by a real player always think at full rate. The others share a per tick
+    // think budget and think less often while no real player is around to see them.
+    bool thinksNow = nextAICheckDelay < elapsed + 100;
+    if (!thinksNow || !chatCommands.empty() || !IsUnattended())
+    {
+        PlayerbotAIBase::UpdateAI(elapsed);
+        return;
+    }
+
+    if (!sRandomPlayerbotMgr.HasThinkBudget() && deferredThinks < 10)
+    {
+        // retry on the next tick, but don't starve bots that always come last in the map update
+        ++deferredThinks;
+        nextAICheckDelay = 0;
+        sRandomPlayerbotMgr.OnBotThinkDeferred();
+        return;
+    }
+    deferredThinks = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     PlayerbotAIBase::UpdateAI(elapsed);
+    sRandomPlayerbotMgr.OnBotThink(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    if (sPlayerbotAIConfig.farBotThinkDelay && nextAICheckDelay < sPlayerbotAIConfig.farBotThinkDelay &&
+            !bot->IsInCombat() && !HasRealPlayerNearby())
+    {
+        nextAICheckDelay = sPlayerbotAIConfig.farBotThinkDelay;
+        sRandomPlayerbotMgr.OnBotThinkSlowed();
+    }
+}
+
+/**
+ * A bot is unattended when no real player commands it: random bots
+ * without a master or grouped only with other bots.
+ */
+bool PlayerbotAI::IsUnattended() const
+{
+    return !master || master->GetPlayerbotAI();
+}
+
+/**
+ * Checks whether a real player is close enough to notice what the bot does.
+ * The result is cached for a few seconds, the map player list can be long.
+ */
+bool PlayerbotAI::HasRealPlayerNearby()
+{
+    uint32 now = getMSTime();
+    if (lastRealPlayerCheck && getMSTimeDiff(lastRealPlayerCheck, now) < 5 * IN_MILLISECONDS)
+    {
+        return realPlayerNearby;
+    }
+
+    lastRealPlayerCheck = now;
+    realPlayerNearby = false;
+
+    Map::PlayerList const& players = bot->GetMap()->GetPlayers();
+    for (Map::PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
+    {
+        Player* player = i->getSource();
+        if (player && player != bot && !player->GetPlayerbotAI() && player->IsWithinDist(bot, sPlayerbotAIConfig.farBotDistance))
+        {
+            realPlayerNearby = true;
+            break;
+        }
+    }
+
+    return realPlayerNearby;
 }
 
 void PlayerbotAI::UpdateAIInternal(uint32 elapsed)
@@ -179,6 +179,10 @@ public:
     static bool IsOpposing(uint8 race1, uint8 race2);
     PlayerbotSecurity* GetSecurity() { return &security; }
 
+private:
+    bool IsUnattended() const;
+    bool HasRealPlayerNearby();
+
 protected:
     Player* bot;
     Player* master;
@@ -194,5 +198,10 @@ protected:
     PacketHandlingHelper masterOutgoingPacketHandlers;
     CompositeChatFilter chatFilter;
     PlayerbotSecurity security;
+
+    // think scheduling of unattended bots
+    uint32 lastRealPlayerCheck;
+    bool realPlayerNearby;
+    uint32 deferredThinks;
 };
 
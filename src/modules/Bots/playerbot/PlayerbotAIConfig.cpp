@@ -67,7 +67,10 @@ PlayerbotAIConfig::PlayerbotAIConfig()
       randomBotMaxLevel(0),
       randomChangeMultiplier(0.0f),
       commandServerPort(0),
-      iterationsPerTick(0)
+      iterationsPerTick(0),
+      maxAIThinkTimePerTick(0),
+      farBotThinkDelay(0),
+      farBotDistance(0.0f)
 {
 }
 
@@ -142,6 +145,10 @@ bool PlayerbotAIConfig::Initialize()
 
     iterationsPerTick = config.GetIntDefault("AiPlayerbot.IterationsPerTick", 4);
 
+    maxAIThinkTimePerTick = config.GetIntDefault("AiPlayerbot.MaxAIThinkTimePerTick", 50);
+    farBotThinkDelay = config.GetIntDefault("AiPlayerbot.FarBotThinkDelay", 2000);
+    farBotDistance = config.GetFloatDefault("AiPlayerbot.FarBotDistance", 150.0f);
+
     allowGuildBots = config.GetBoolDefault("AiPlayerbot.AllowGuildBots", true);
 
     // Load lists of values from the configuration file
@@ -78,6 +78,10 @@ public:
 
     uint32 iterationsPerTick; ///< Number of iterations per tick.
 
+    uint32 maxAIThinkTimePerTick; ///< Time in ms unattended bots may spend thinking per world tick, 0 = unlimited.
+    uint32 farBotThinkDelay; ///< Minimal delay in ms between thinks of unattended bots without real players nearby.
+    float farBotDistance; ///< Distance within which a real player counts as nearby.
+
     int commandServerPort; ///< Port for the command server.
 
     /**
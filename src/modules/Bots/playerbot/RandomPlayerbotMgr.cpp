@@ -17,7 +17,9 @@ INSTANTIATE_SINGLETON_1(RandomPlayerbotMgr);
  * It handles the creation, updating, and processing of these bots, ensuring they
  * behave in a way that simulates real player activity.
  */
-RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0)
+RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0), thinkTime(0), thinkCount(0), deferredThinkCount(0),
+    slowedThinkCount(0), reportThinkTime(0), reportThinkCount(0), reportDeferredThinkCount(0), reportSlowedThinkCount(0), reportTicks(0),
+    eventCacheLoaded(false), spawnIndexLoaded(false), spawnCellSize(0.0f), botCharactersLoaded(false)
 {
 }
 
@@ -25,10 +27,38 @@ RandomPlayerbotMgr::~RandomPlayerbotMgr()
 {
 }
 
+/**
+ * Called once per world tick before the maps are updated, so this is where
+ * the think budget shared by all unattended bots is refilled.
+ */
+void RandomPlayerbotMgr::UpdateAI(uint32 elapsed)
+{
+    reportThinkTime += thinkTime.exchange(0);
+    reportThinkCount += thinkCount.exchange(0);
+    reportDeferredThinkCount += deferredThinkCount.exchange(0);
+    reportSlowedThinkCount += slowedThinkCount.exchange(0);
+    ++reportTicks;
+
+    PlayerbotHolder::UpdateAI(elapsed);
+}
+
+bool RandomPlayerbotMgr::HasThinkBudget() const
+{
+    return !sPlayerbotAIConfig.maxAIThinkTimePerTick || thinkTime < uint64(sPlayerbotAIConfig.maxAIThinkTimePerTick) * 1000;
+}
+
 void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed)
 {
     SetNextCheckDelay(sPlayerbotAIConfig.randomBotUpdateInterval * 1000);
 
+    if (reportTicks && reportThinkCount)
+    {
+        sLog.outString("Bot AI per tick: %u thinks in %u us, %u deferred over budget, %u slowed down (no players nearby)",
+                reportThinkCount / reportTicks, uint32(reportThinkTime / reportTicks), reportDeferredThinkCount / reportTicks, reportSlowedThinkCount / reportTicks);
+    }
+    reportThinkTime = 0;
+    reportThinkCount = reportDeferredThinkCount = reportSlowedThinkCount = reportTicks = 0;
+
     if (!sPlayerbotAIConfig.randomBotAutologin || !sPlayerbotAIConfig.enabled)
     {
         return;
@@ -291,28 +321,17 @@ void RandomPlayerbotMgr::RandomTeleport(Player* bot, vector<WorldLocation> &locs
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
 {
+    LoadSpawnIndex();
+
     vector<WorldLocation> locs;
-    QueryResult* results = WorldDatabase.PQuery("SELECT `map`, `position_x`, `position_y`, `position_z` FROM ("
-        "SELECT MIN(`c`.`map`) `map`, MIN(`c`.`position_x`) `position_x`, MIN(`c`.`position_y`) `position_y`, "
-    "MIN(`c`.`position_z`) `position_z`, AVG(`t`.`maxlevel`), AVG(`t`.`minlevel`), "
-        "%u - (AVG(`t`.`maxlevel`) + AVG(`t`.`minlevel`)) / 2 `delta` FROM `creature` `c` "
-    "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` GROUP BY `t`.`entry`) `q` "
-        "WHERE `delta` >= 0 AND `delta` <= %u AND `map` IN (%s)",
-
-        bot->getLevel(), sPlayerbotAIConfig.randomBotTeleLevel, sPlayerbotAIConfig.randomBotMapsAsString.c_str());
-    if (results)
+    float level = bot->getLevel();
+    for (vector<SpawnLocation>::const_iterator i = levelSpawns.begin(); i != levelSpawns.end(); ++i)
     {
-        do
+        float delta = level - (i->maxLevel + i->minLevel) / 2.0f;
+        if (delta >= 0 && delta <= sPlayerbotAIConfig.randomBotTeleLevel)
         {
-            Field* fields = results->Fetch();
-            uint32 mapId = fields[0].GetUInt32();
-            float x = fields[1].GetFloat();
-            float y = fields[2].GetFloat();
-            float z = fields[3].GetFloat();
-            WorldLocation loc(mapId, x, y, z, 0);
-            locs.push_back(loc);
-        } while (results->NextRow());
-        delete results;
+            locs.push_back(WorldLocation(i->mapId, i->x, i->y, i->z, 0));
+        }
     }
 
     RandomTeleport(bot, locs);
@@ -320,21 +339,14 @@ void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
 
 void RandomPlayerbotMgr::RandomTeleport(Player* bot, uint32 mapId, float teleX, float teleY, float teleZ)
 {
+    vector<SpawnLocation const*> spawns;
+    GetSpawnsAround(mapId, teleX, teleY, spawns);
+
     vector<WorldLocation> locs;
-    QueryResult* results = WorldDatabase.PQuery("SELECT `position_x`, `position_y`, `position_z` FROM `creature` WHERE `map` = '%u' AND ABS(`position_x` - '%f') < '%u' AND ABS(`position_y` - '%f') < '%u'",
-            mapId, teleX, sPlayerbotAIConfig.randomBotTeleportDistance / 2, teleY, sPlayerbotAIConfig.randomBotTeleportDistance / 2);
-    if (results)
+    locs.reserve(spawns.size());
+    for (vector<SpawnLocation const*>::const_iterator i = spawns.begin(); i != spawns.end(); ++i)
     {
-        do
-        {
-            Field* fields = results->Fetch();
-            float x = fields[0].GetFloat();
-            float y = fields[1].GetFloat();
-            float z = fields[2].GetFloat();
-            WorldLocation loc(mapId, x, y, z, 0);
-            locs.push_back(loc);
-        } while (results->NextRow());
-        delete results;
+        locs.push_back(WorldLocation(mapId, (*i)->x, (*i)->y, (*i)->z, 0));
     }
 
     RandomTeleport(bot, locs);
@@ -427,32 +439,117 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
 
 uint32 RandomPlayerbotMgr::GetZoneLevel(uint32 mapId, float teleX, float teleY, float teleZ)
 {
-    uint32 maxLevel = sWorld.getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL);
+    vector<SpawnLocation const*> spawns;
+    GetSpawnsAround(mapId, teleX, teleY, spawns);
 
-    uint32 level;
-    QueryResult *results = WorldDatabase.PQuery("SELECT AVG(`t`.`minlevel`) `minlevel`, AVG(`t`.`maxlevel`) `maxlevel` FROM `creature` `c` "
-            "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` "
-            "WHERE `map` = '%u' AND `minlevel` > 1 AND ABS(`position_x` - '%f') < '%u' AND ABS(`position_y` - '%f') < '%u'",
-            mapId, teleX, sPlayerbotAIConfig.randomBotTeleportDistance / 2, teleY, sPlayerbotAIConfig.randomBotTeleportDistance / 2);
+    uint32 minLevel = 0, maxLevel = 0, count = 0;
+    for (vector<SpawnLocation const*>::const_iterator i = spawns.begin(); i != spawns.end(); ++i)
+    {
+        if ((*i)->minLevel > 1)
+        {
+            minLevel += (*i)->minLevel;
+            maxLevel += (*i)->maxLevel;
+            ++count;
+        }
+    }
 
-    if (results)
+    if (!count)
     {
-        Field* fields = results->Fetch();
-        uint32 minLevel = fields[0].GetUInt32();
-        uint32 maxLevel = fields[1].GetUInt32();
-        level = urand(minLevel, maxLevel);
-        if (level > maxLevel)
+        return 0;
+    }
+
+    return urand(minLevel / count, maxLevel / count);
+}
+
+/**
+ * Indexes all creature spawns by map and by square cells of the teleport
+ * distance, so the areas around a teleport point can be looked up without
+ * scanning the creature table.
+ */
+void RandomPlayerbotMgr::LoadSpawnIndex()
+{
+    if (spawnIndexLoaded)
+    {
+        return;
+    }
+
+    spawnIndexLoaded = true;
+    spawnCellSize = max(float(sPlayerbotAIConfig.randomBotTeleportDistance), 100.0f);
+
+    set<uint32> botMaps(sPlayerbotAIConfig.randomBotMaps.begin(), sPlayerbotAIConfig.randomBotMaps.end());
+    set<uint32> levelEntries;
+    uint32 count = 0;
+
+    CreatureDataMap const* creatures = sObjectMgr.GetCreatureDataMap();
+    for (CreatureDataMap::const_iterator itr = creatures->begin(); itr != creatures->end(); ++itr)
+    {
+        CreatureData const& data = itr->second;
+        CreatureInfo const* info = ObjectMgr::GetCreatureTemplate(data.id);
+        if (!info)
         {
-            level = maxLevel;
+            continue;
+        }
+
+        SpawnLocation spawn;
+        spawn.mapId = data.mapid;
+        spawn.x = data.posX;
+        spawn.y = data.posY;
+        spawn.z = data.posZ;
+        spawn.minLevel = info->MinLevel;
+        spawn.maxLevel = info->MaxLevel;
+
+        spawnIndex[spawn.mapId][GetSpawnCellKey(spawn.x, spawn.y)].push_back(spawn);
+        ++count;
+
+        if (botMaps.find(spawn.mapId) != botMaps.end() && levelEntries.insert(data.id).second)
+        {
+            levelSpawns.push_back(spawn);
         }
-        delete results;
     }
-    else
+
+    sLog.outString("Indexed %u creature spawns for random bot teleports", count);
+}
+
+uint64 RandomPlayerbotMgr::GetSpawnCellKey(float x, float y) const
+{
+    int32 cellX = int32(floor(x / spawnCellSize));
+    int32 cellY = int32(floor(y / spawnCellSize));
+    return (uint64(uint32(cellX)) << 32) | uint32(cellY);
+}
+
+void RandomPlayerbotMgr::GetSpawnsAround(uint32 mapId, float x, float y, vector<SpawnLocation const*>& spawns)
+{
+    LoadSpawnIndex();
+
+    SpawnIndex::const_iterator cells = spawnIndex.find(mapId);
+    if (cells == spawnIndex.end())
     {
-        level = urand(1, maxLevel);
+        return;
     }
 
-    return level;
+    float range = sPlayerbotAIConfig.randomBotTeleportDistance / 2;
+    int32 minX = int32(floor((x - range) / spawnCellSize)), maxX = int32(floor((x + range) / spawnCellSize));
+    int32 minY = int32(floor((y - range) / spawnCellSize)), maxY = int32(floor((y + range) / spawnCellSize));
+
+    for (int32 cellX = minX; cellX <= maxX; ++cellX)
+    {
+        for (int32 cellY = minY; cellY <= maxY; ++cellY)
+        {
+            SpawnCells::const_iterator cell = cells->second.find((uint64(uint32(cellX)) << 32) | uint32(cellY));
+            if (cell == cells->second.end())
+            {
+                continue;
+            }
+
+            for (vector<SpawnLocation>::const_iterator i = cell->second.begin(); i != cell->second.end(); ++i)
+            {
+                if (fabs(i->x - x) < range && fabs(i->y - y) < range)
+                {
+                    spawns.push_back(&*i);
+                }
+            }
+        }
+    }
 }
 
 void RandomPlayerbotMgr::Refresh(Player* bot)
@@ -511,116 +608,193 @@ bool RandomPlayerbotMgr::IsRandomBot(uint32 bot)
 
 list<uint32> RandomPlayerbotMgr::GetBots()
 {
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, eventCacheLock, list<uint32>());
+    LoadEventCache();
+
     list<uint32> bots;
+    for (BotEventCache::const_iterator i = eventCache.begin(); i != eventCache.end(); ++i)
+    {
+        if (i->second.find("add") != i->second.end())
+        {
+            bots.push_back(i->first);
+        }
+    }
 
-    // Query the database to get the list of random bots
-    QueryResult* results = CharacterDatabase.Query(
-            "SELECT `bot` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `event` = 'add'");
+    return bots;
+}
+
+vector<uint32> RandomPlayerbotMgr::GetFreeBots(bool alliance)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, eventCacheLock, vector<uint32>());
+    LoadEventCache();
+    LoadBotCharacters();
+
+    vector<uint32> guids;
+    for (vector<BotCharacter>::const_iterator i = botCharacters.begin(); i != botCharacters.end(); ++i)
+    {
+        BotEventCache::const_iterator events = eventCache.find(i->guid);
+        if (events != eventCache.end() && events->second.find("add") != events->second.end())
+        {
+            continue;
+        }
+
+        if (alliance == IsAlliance(i->race))
+        {
+            guids.push_back(i->guid);
+        }
+    }
+
+    return guids;
+}
+
+void RandomPlayerbotMgr::LoadBotCharacters()
+{
+    if (botCharactersLoaded)
+    {
+        return;
+    }
+
+    botCharactersLoaded = true;
+    if (sPlayerbotAIConfig.randomBotAccounts.empty())
+    {
+        return;
+    }
 
+    ostringstream accounts;
+    for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); ++i)
+    {
+        if (i != sPlayerbotAIConfig.randomBotAccounts.begin())
+        {
+            accounts << ",";
+        }
+        accounts << *i;
+    }
+
+    QueryResult* results = CharacterDatabase.PQuery("SELECT `guid`, `race` FROM `characters` WHERE `account` IN (%s)", accounts.str().c_str());
     if (results)
     {
         do
         {
             Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.push_back(bot);
+            BotCharacter character;
+            character.guid = fields[0].GetUInt32();
+            character.race = fields[1].GetUInt8();
+            botCharacters.push_back(character);
         } while (results->NextRow());
         delete results;
     }
-
-    return bots;
 }
 
-vector<uint32> RandomPlayerbotMgr::GetFreeBots(bool alliance)
+void RandomPlayerbotMgr::LoadEventCache()
 {
-    set<uint32> bots;
+    if (eventCacheLoaded)
+    {
+        return;
+    }
 
-    QueryResult* results = CharacterDatabase.PQuery(
-        "SELECT `bot` FROM `ai_playerbot_random_bots` WHERE `event` = 'add'"
-    );
+    eventCacheLoaded = true;
 
+    QueryResult* results = CharacterDatabase.Query(
+            "SELECT `bot`, `event`, `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0");
     if (results)
     {
         do
         {
             Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.insert(bot);
+            BotEvent& event = eventCache[fields[0].GetUInt32()][fields[1].GetCppString()];
+            event.value = fields[2].GetUInt32();
+            event.lastChangeTime = fields[3].GetUInt32();
+            event.validIn = fields[4].GetUInt32();
         } while (results->NextRow());
         delete results;
     }
+}
 
-    vector<uint32> guids;
-    for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); i++)
-    {
-        uint32 accountId = *i;
-        if (!sAccountMgr.GetCharactersCount(accountId))
-        {
-            continue;
-        }
+uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string const& event)
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, eventCacheLock, 0);
+    LoadEventCache();
 
-        QueryResult *result = CharacterDatabase.PQuery("SELECT `guid`, `race` FROM `characters` WHERE `account` = '%u'", accountId);
-        if (!result)
-        {
-            continue;
-        }
+    BotEventCache::const_iterator events = eventCache.find(bot);
+    if (events == eventCache.end())
+    {
+        return 0;
+    }
 
-        do
-        {
-            Field* fields = result->Fetch();
-            uint32 guid = fields[0].GetUInt32();
-            uint32 race = fields[1].GetUInt32();
-            if (bots.find(guid) == bots.end() &&
-                    ((alliance && IsAlliance(race)) || ((!alliance && !IsAlliance(race))
-            )))
-                guids.push_back(guid);
-        } while (result->NextRow());
-        delete result;
+    BotEventMap::const_iterator found = events->second.find(event);
+    if (found == events->second.end())
+    {
+        return 0;
     }
 
+    if ((time(0) - found->second.lastChangeTime) >= found->second.validIn)
+    {
+        return 0;
+    }
 
-    return guids;
+    return found->second.value;
 }
 
-uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string event)
+uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, string const& event, uint32 value, uint32 validIn)
 {
-    uint32 value = 0;
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, eventCacheLock, value);
+    LoadEventCache();
 
-    // Query the database to get the event value for the specified bot
-    QueryResult* results = CharacterDatabase.PQuery(
-            "SELECT `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `bot` = '%u' AND `event` = '%s'",
+    // the cache is authoritative, the table only keeps it across restarts
+    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 and `bot` = '%u' and `event` = '%s'",
             bot, event.c_str());
+    if (value)
+    {
+        BotEvent& cached = eventCache[bot][event];
+        cached.value = value;
+        cached.lastChangeTime = (uint32)time(0);
+        cached.validIn = validIn;
 
-    if (results)
+        CharacterDatabase.PExecute(
+                "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES ('%u', '%u', '%u', '%u', '%s', '%u')",
+                0, bot, cached.lastChangeTime, validIn, event.c_str(), value);
+    }
+    else
     {
-        Field* fields = results->Fetch();
-        value = fields[0].GetUInt32();
-        uint32 lastChangeTime = fields[1].GetUInt32();
-        uint32 validIn = fields[2].GetUInt32();
-        if ((time(0) - lastChangeTime) >= validIn)
+        BotEventCache::iterator events = eventCache.find(bot);
+        if (events != eventCache.end())
         {
-            value = 0;
+            events->second.erase(event);
+            if (events->second.empty())
+            {
+                eventCache.erase(events);
+            }
         }
-        delete results;
     }
 
     return value;
 }
 
-uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, string event, uint32 value, uint32 validIn)
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, string const& event, uint32 validIn)
 {
-    // Delete the existing event value for the specified bot
-    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 and `bot` = '%u' and `event` = '%s'",
-            bot, event.c_str());
-    if (value)
+    ACE_GUARD(ACE_Thread_Mutex, guard, eventCacheLock);
+    LoadEventCache();
+
+    BotEventCache::iterator events = eventCache.find(bot);
+    if (events != eventCache.end())
     {
-        // Insert the new event value for the specified bot
-        CharacterDatabase.PExecute(
-                "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES ('%u', '%u', '%u', '%u', '%s', '%u')",
-                0, bot, (uint32)time(0), validIn, event.c_str(), value);
+        BotEventMap::iterator found = events->second.find(event);
+        if (found != events->second.end())
+        {
+            found->second.validIn = validIn;
+        }
     }
 
-    return value;
+    CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = '%s' AND `bot` = '%u'",
+            validIn, event.c_str(), bot);
+}
+
+void RandomPlayerbotMgr::ClearEventValues()
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, eventCacheLock);
+    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots`");
+    eventCache.clear();
+    eventCacheLoaded = true;
 }
 
 bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
@@ -643,7 +817,7 @@ bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
     if (cmd == "reset")
     {
         // Reset all random bots
-        CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots`");
+        sRandomPlayerbotMgr.ClearEventValues();
         sLog.outBasic("Random bots were reset for all players");
         return true;
     }
@@ -691,10 +865,8 @@ bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
                         sRandomPlayerbotMgr.IncreaseLevel(bot);
                     }
                     uint32 randomTime = urand(sPlayerbotAIConfig.minRandomBotRandomizeTime, sPlayerbotAIConfig.maxRandomBotRandomizeTime);
-                    CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'randomize' AND `bot` = '%u'",
-                            randomTime, bot->GetGUIDLow());
-                    CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'logout' AND `bot` = '%u'",
-                            sPlayerbotAIConfig.maxRandomBotInWorldTime, bot->GetGUIDLow());
+                    sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "randomize", randomTime);
+                    sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "logout", sPlayerbotAIConfig.maxRandomBotInWorldTime);
                 } while (results->NextRow());
 
                 delete results;
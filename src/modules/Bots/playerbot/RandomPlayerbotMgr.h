@@ -5,6 +5,9 @@
 #include "PlayerbotAIBase.h"
 #include "PlayerbotMgr.h"
 
+#include <atomic>
+#include <ace/Thread_Mutex.h>
+
 class WorldPacket;
 class Player;
 class Unit;
@@ -41,14 +44,23 @@ class MANGOS_DLL_SPEC RandomPlayerbotMgr : public PlayerbotHolder
         void SetLootAmount(Player* bot, uint32 value);
         uint32 GetTradeDiscount(Player* bot);
         void Refresh(Player* bot);
+        virtual void UpdateAI(uint32 elapsed);
         virtual void UpdateAIInternal(uint32 elapsed);
+        void SetEventValidIn(uint32 bot, string const& event, uint32 validIn);
+        void ClearEventValues();
+
+        // Think scheduling of unattended bots, called from map update threads
+        bool HasThinkBudget() const;
+        void OnBotThink(uint64 us) { thinkTime += us; ++thinkCount; }
+        void OnBotThinkDeferred() { ++deferredThinkCount; }
+        void OnBotThinkSlowed() { ++slowedThinkCount; }
 
     protected:
         virtual void OnBotLoginInternal(Player * const bot) {}
 
     private:
-        uint32 GetEventValue(uint32 bot, string event);
-        uint32 SetEventValue(uint32 bot, string event, uint32 value, uint32 validIn);
+        uint32 GetEventValue(uint32 bot, string const& event);
+        uint32 SetEventValue(uint32 bot, string const& event, uint32 value, uint32 validIn);
         list<uint32> GetBots();
         vector<uint32> GetFreeBots(bool alliance);
         uint32 AddRandomBot(bool alliance);
@@ -59,9 +71,67 @@ class MANGOS_DLL_SPEC RandomPlayerbotMgr : public PlayerbotHolder
         void RandomTeleport(Player* bot, vector<WorldLocation> &locs);
         uint32 GetZoneLevel(uint32 mapId, float teleX, float teleY, float teleZ);
 
+        // in-memory copies of the data the bot maintenance used to query for every bot
+        struct BotEvent
+        {
+            uint32 value;
+            uint32 lastChangeTime;
+            uint32 validIn;
+        };
+
+        struct SpawnLocation
+        {
+            uint32 mapId;
+            float x, y, z;
+            uint32 minLevel, maxLevel;
+        };
+
+        struct BotCharacter
+        {
+            uint32 guid;
+            uint8 race;
+        };
+
+        typedef map<string, BotEvent> BotEventMap;
+        typedef UNORDERED_MAP<uint32, BotEventMap> BotEventCache;
+        typedef UNORDERED_MAP<uint64, vector<SpawnLocation> > SpawnCells;
+        typedef UNORDERED_MAP<uint32, SpawnCells> SpawnIndex;
+
+        void LoadEventCache();                              // caller holds eventCacheLock
+        void LoadSpawnIndex();
+        void LoadBotCharacters();
+        uint64 GetSpawnCellKey(float x, float y) const;
+        void GetSpawnsAround(uint32 mapId, float x, float y, vector<SpawnLocation const*>& spawns);
+
     private:
         vector<Player*> players;
         int processTicks;
+
+        // read by the bot actions of all map threads, written by the world thread
+        bool eventCacheLoaded;
+        BotEventCache eventCache;
+        ACE_Thread_Mutex eventCacheLock;
+
+        bool spawnIndexLoaded;
+        float spawnCellSize;
+        SpawnIndex spawnIndex;                              // creature spawns by map and cell
+        vector<SpawnLocation> levelSpawns;                  // one spawn per creature entry on random bot maps
+
+        bool botCharactersLoaded;
+        vector<BotCharacter> botCharacters;
+
+        // current world tick
+        std::atomic<uint64> thinkTime;
+        std::atomic<uint32> thinkCount;
+        std::atomic<uint32> deferredThinkCount;
+        std::atomic<uint32> slowedThinkCount;
+
+        // accumulated since the last report
+        uint64 reportThinkTime;
+        uint32 reportThinkCount;
+        uint32 reportDeferredThinkCount;
+        uint32 reportSlowedThinkCount;
+        uint32 reportTicks;
 };
 
 #define sRandomPlayerbotMgr MaNGOS::Singleton<RandomPlayerbotMgr>::Instance()
@@ -15,29 +15,33 @@ namespace ai
         virtual ~AiObjectContext() {}
 
     public:
-        virtual Strategy* GetStrategy(string name) { return strategyContexts.GetObject(name, ai); }
-        virtual set<string> GetSiblingStrategy(string name) { return strategyContexts.GetSiblings(name); }
-        virtual Trigger* GetTrigger(string name) { return triggerContexts.GetObject(name, ai); }
-        virtual Action* GetAction(string name) { return actionContexts.GetObject(name, ai); }
-        virtual UntypedValue* GetUntypedValue(string name) { return valueContexts.GetObject(name, ai); }
+        virtual Strategy* GetStrategy(string const& name) { return strategyContexts.GetObject(name, ai); }
+        virtual set<string> GetSiblingStrategy(string const& name) { return strategyContexts.GetSiblings(name); }
+        virtual Trigger* GetTrigger(string const& name) { return triggerContexts.GetObject(name, ai); }
+        virtual Action* GetAction(string const& name) { return actionContexts.GetObject(name, ai); }
+        virtual UntypedValue* GetUntypedValue(string const& name) { return valueContexts.GetObject(name, ai); }
 
         template<class T>
-        Value<T>* GetValue(string name)
+        Value<T>* GetValue(string const& name)
         {
             return dynamic_cast<Value<T>*>(GetUntypedValue(name));
         }
 
         template<class T>
-        Value<T>* GetValue(string name, string param)
+        Value<T>* GetValue(string const& name, string const& param)
         {
-            return GetValue<T>((string(name) + "::" + param));
+            string qualified;
+            qualified.reserve(name.size() + 2 + param.size());
+            qualified.append(name).append("::").append(param);
+            return GetValue<T>(qualified);
         }
 
         template<class T>
-        Value<T>* GetValue(string name, uint32 param)
+        Value<T>* GetValue(string const& name, uint32 param)
         {
-            ostringstream out; out << param;
-            return GetValue<T>(name, out.str());
+            char buf[11];
+            snprintf(buf, sizeof(buf), "%u", param);
+            return GetValue<T>(name, string(buf));
         }
 
         set<string> GetSupportedStrategies()
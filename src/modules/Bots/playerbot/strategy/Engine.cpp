@@ -95,6 +95,7 @@ void Engine::Reset()
 void Engine::Init()
 {
     Reset();
+    actionNodeOwners.clear();
 
     for (map<string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
     {
@@ -229,17 +230,35 @@ bool Engine::DoNextAction(Unit* unit, int depth)
     return actionExecuted;
 }
 
-ActionNode* Engine::CreateActionNode(string name)
+ActionNode* Engine::CreateActionNode(string const& name)
 {
-    for (map<string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
+    UNORDERED_MAP<string, Strategy*>::const_iterator owner = actionNodeOwners.find(name);
+    if (owner != actionNodeOwners.end())
     {
-        Strategy* strategy = i->second;
-        ActionNode* node = strategy->GetAction(name);
-        if (node)
+        if (owner->second)
         {
-            return node;
+            if (ActionNode* node = owner->second->GetAction(name))
+            {
+                return node;
+            }
         }
     }
+    else
+    {
+        for (map<string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
+        {
+            Strategy* strategy = i->second;
+            ActionNode* node = strategy->GetAction(name);
+            if (node)
+            {
+                actionNodeOwners[name] = strategy;
+                return node;
+            }
+        }
+
+        actionNodeOwners[name] = NULL;
+    }
+
     return new ActionNode (name,
         /*P*/ NULL,
         /*A*/ NULL,
@@ -511,11 +530,17 @@ bool Engine::ListenAndExecute(Action* action, Event event)
 
 void Engine::LogAction(const char* format, ...)
 {
+    // called for every trigger, push and execution - don't format what nobody reads
+    if (!testMode && !sLog.HasLogLevelOrHigher(LOG_LVL_DEBUG))
+    {
+        return;
+    }
+
     char buf[1024];
 
     va_list ap;
     va_start(ap, format);
-    vsprintf(buf, format, ap);
+    vsnprintf(buf, sizeof(buf), format, ap);
     va_end(ap);
     lastAction = buf;
 
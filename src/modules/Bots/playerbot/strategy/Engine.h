@@ -132,7 +132,7 @@ namespace ai
         void ProcessTriggers();
         void PushDefaultActions();
         void PushAgain(ActionNode* actionNode, float relevance, Event event);
-        ActionNode* CreateActionNode(string name);
+        ActionNode* CreateActionNode(string const& name);
         Action* InitializeAction(ActionNode* actionNode);
         bool ListenAndExecute(Action* action, Event event);
 
@@ -146,8 +146,9 @@ namespace ai
         std::list<Multiplier*> multipliers; /**< List of multipliers */
         AiObjectContext* aiObjectContext; /**< AI object context */
         std::map<string, Strategy*> strategies; /**< Map of strategies */
+        UNORDERED_MAP<string, Strategy*> actionNodeOwners; /**< Strategy providing each action node, rebuilt on Init */
         float lastRelevance; /**< Last relevance value */
-        std::string lastAction; /**< Last executed action */
+        std::string lastAction; /**< Last logged action, only tracked while action logging is active */
 
     public:
         bool testMode; /**< Flag for test mode */
@@ -23,32 +23,25 @@ namespace ai
         map<string, ActionCreator> creators;
 
     public:
-        T* create(string name, PlayerbotAI* ai)
+        T* create(string const& name, PlayerbotAI* ai)
         {
             size_t found = name.find("::");
-            string qualifier;
-            if (found != string::npos)
-            {
-                qualifier = name.substr(found + 2);
-                name = name.substr(0, found);
-            }
+            typename map<string, ActionCreator>::const_iterator creator =
+                found == string::npos ? creators.find(name) : creators.find(name.substr(0, found));
 
-            if (creators.find(name) == creators.end())
+            if (creator == creators.end() || !creator->second)
             {
                 return NULL;
             }
 
-            ActionCreator creator = creators[name];
-            if (!creator)
-            {
-                return NULL;
-            }
-
-            T *object = (*creator)(ai);
-            Qualified *q = dynamic_cast<Qualified *>(object);
-            if (q)
+            T *object = (*creator->second)(ai);
+            if (found != string::npos)
             {
-                q->Qualify(qualifier);
+                Qualified *q = dynamic_cast<Qualified *>(object);
+                if (q)
+                {
+                    q->Qualify(name.substr(found + 2));
+                }
             }
 
             return object;
@@ -72,14 +65,15 @@ namespace ai
         NamedObjectContext(bool shared = false, bool supportsSiblings = false) :
             NamedObjectFactory<T>(), shared(shared), supportsSiblings(supportsSiblings) {}
 
-        T* create(string name, PlayerbotAI* ai)
+        T* create(string const& name, PlayerbotAI* ai)
         {
-            if (created.find(name) == created.end())
+            typename map<string, T*>::const_iterator found = created.find(name);
+            if (found != created.end())
             {
-                return created[name] = NamedObjectFactory<T>::create(name, ai);
+                return found->second;
             }
 
-            return created[name];
+            return created[name] = NamedObjectFactory<T>::create(name, ai);
         }
 
         virtual ~NamedObjectContext()
@@ -159,16 +153,28 @@ namespace ai
         void Add(NamedObjectContext<T>* context)
         {
             contexts.push_back(context);
+            resolved.clear();
         }
 
-        T* GetObject(string name, PlayerbotAI* ai)
+        // Objects are looked up by name on every AI decision, so remember which
+        // context answered (or that none did) and skip the context walk next time
+        T* GetObject(string const& name, PlayerbotAI* ai)
         {
+            typename UNORDERED_MAP<string, T*>::const_iterator found = resolved.find(name);
+            if (found != resolved.end())
+            {
+                return found->second;
+            }
+
+            T* object = NULL;
             for (typename list<NamedObjectContext<T>*>::iterator i = contexts.begin(); i != contexts.end(); i++)
             {
-                T* object = (*i)->create(name, ai);
-                if (object) return object;
+                object = (*i)->create(name, ai);
+                if (object) break;
             }
-            return NULL;
+
+            resolved[name] = object;
+            return object;
         }
 
         void Update()
@@ -190,7 +196,7 @@ namespace ai
             }
         }
 
-        set<string> GetSiblings(string name)
+        set<string> GetSiblings(string const& name)
         {
             for (typename list<NamedObjectContext<T>*>::iterator i = contexts.begin(); i != contexts.end(); i++)
             {
@@ -247,6 +253,7 @@ namespace ai
 
     private:
         list<NamedObjectContext<T>*> contexts;
+        UNORDERED_MAP<string, T*> resolved;
     };
 
     template <class T> class NamedObjectFactoryList
@@ -265,7 +272,7 @@ namespace ai
             factories.push_front(context);
         }
 
-        T* GetObject(string name, PlayerbotAI* ai)
+        T* GetObject(string const& name, PlayerbotAI* ai)
         {
             for (typename list<NamedObjectFactory<T>*>::iterator i = factories.begin(); i != factories.end(); i++)
             {
@@ -110,7 +110,7 @@ Strategy::Strategy(PlayerbotAI* ai) : PlayerbotAIAware(ai)
     actionNodeFactories.Add(new ActionNodeFactoryInternal());
 }
 
-ActionNode* Strategy::GetAction(string name)
+ActionNode* Strategy::GetAction(string const& name)
 {
     return actionNodeFactories.GetObject(name, ai);
 }
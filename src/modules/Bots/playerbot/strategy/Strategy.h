@@ -44,7 +44,7 @@ namespace ai
         virtual void InitMultipliers(std::list<Multiplier*> &multipliers) {}
         virtual string getName() = 0;
         virtual int GetType() { return STRATEGY_TYPE_GENERIC; }
-        virtual ActionNode* GetAction(string name);
+        virtual ActionNode* GetAction(string const& name);
         void Update() {}
         void Reset() {}
 
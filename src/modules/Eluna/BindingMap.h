@@ -18,6 +18,7 @@ extern "C"
 #include "lauxlib.h"
 };
 
+template <typename T> struct EntryKey;
 
 /*
  * A set of bindings from keys of type `K` to Lua references.
@@ -35,12 +36,14 @@ private:
         lua_State* L;
         uint32 remainingShots;
         int functionReference;
+        K key;
 
-        Binding(lua_State* L, uint64 id, int functionReference, uint32 remainingShots) :
+        Binding(lua_State* L, uint64 id, int functionReference, uint32 remainingShots, const K& key) :
             id(id),
             L(L),
             remainingShots(remainingShots),
-            functionReference(functionReference)
+            functionReference(functionReference),
+            key(key)
         { }
 
         ~Binding()
@@ -64,6 +67,67 @@ private:
      */
     std::unordered_map<uint64, BindingList*> id_lookup_table;
 
+    /*
+     * Bitmaps of the keys that have bindings, checked before `bindings` is searched.
+     *
+     * Hooks are called far more often than scripts register for them, so an
+     *   unused event (or for `EntryKey` an unused entry of an event, e.g. an opcode)
+     *   is rejected with an array access instead of hashing the key.
+     * `event_key_counts` holds the number of keys with bindings per event ID,
+     *   `entry_bits` one bit per entry and event ID.
+     */
+    std::vector<uint32> event_key_counts;
+    std::vector< std::vector<uint64> > entry_bits;
+
+    template<typename T>
+    void SetEntryBit(const EntryKey<T>& key, bool value)
+    {
+        uint32 event_id = static_cast<uint32>(key.event_id);
+        if (entry_bits.size() <= event_id)
+            entry_bits.resize(event_id + 1);
+
+        std::vector<uint64>& bits = entry_bits[event_id];
+        if (bits.size() <= key.entry / 64)
+            bits.resize(key.entry / 64 + 1, 0);
+
+        if (value)
+            bits[key.entry / 64] |= uint64(1) << (key.entry % 64);
+        else
+            bits[key.entry / 64] &= ~(uint64(1) << (key.entry % 64));
+    }
+
+    template<typename T>
+    bool HasEntryBit(const EntryKey<T>& key) const
+    {
+        uint32 event_id = static_cast<uint32>(key.event_id);
+        if (entry_bits.size() <= event_id || entry_bits[event_id].size() <= key.entry / 64)
+            return false;
+
+        return (entry_bits[event_id][key.entry / 64] & (uint64(1) << (key.entry % 64))) != 0;
+    }
+
+    // Keys other than `EntryKey` are only filtered by event ID.
+    template<typename KT>
+    void SetEntryBit(const KT& /*key*/, bool /*value*/) { }
+
+    template<typename KT>
+    bool HasEntryBit(const KT& /*key*/) const { return true; }
+
+    // Called when the binding list of `key` stops or starts being empty.
+    void SetKeyBound(const K& key, bool bound)
+    {
+        uint32 event_id = static_cast<uint32>(key.event_id);
+        if (event_key_counts.size() <= event_id)
+            event_key_counts.resize(event_id + 1, 0);
+
+        if (bound)
+            ++event_key_counts[event_id];
+        else
+            --event_key_counts[event_id];
+
+        SetEntryBit(key, bound);
+    }
+
 public:
     BindingMap(lua_State* L) :
         L(L),
@@ -80,7 +144,10 @@ public:
     {
         uint64 id = (++maxBindingID);
         BindingList& list = bindings[key];
-        list.push_back(std::unique_ptr<Binding>(new Binding(L, id, ref, shots)));
+        if (list.empty())
+            SetKeyBound(key, true);
+
+        list.push_back(std::unique_ptr<Binding>(new Binding(L, id, ref, shots, key)));
         id_lookup_table[id] = &list;
         return id;
     }
@@ -98,6 +165,8 @@ public:
             return;
 
         BindingList& list = iter->second;
+        if (!list.empty())
+            SetKeyBound(key, false);
 
         // Remove all pointers to `list` from `id_lookup_table`.
         for (auto i = list.begin(); i != list.end(); ++i)
@@ -119,6 +188,8 @@ public:
 
         id_lookup_table.clear();
         bindings.clear();
+        event_key_counts.clear();
+        entry_bits.clear();
     }
 
     /*
@@ -143,8 +214,14 @@ public:
         }
 
         if (i != list->end())
+        {
+            const K key = (*i)->key;
             list->erase(i);
 
+            if (list->empty())
+                SetKeyBound(key, false);
+        }
+
         // Unconditionally erase the ID in the lookup table because
         //   it was either already invalid, or it's no longer valid.
         id_lookup_table.erase(id);
@@ -155,7 +232,7 @@ public:
      */
     bool HasBindingsFor(const K& key)
     {
-        if (bindings.empty())
+        if (!HasBindingsForEvent(static_cast<uint32>(key.event_id)) || !HasEntryBit(key))
             return false;
 
         auto result = bindings.find(key);
@@ -166,6 +243,14 @@ public:
         return !list.empty();
     }
 
+    /*
+     * Check whether any key of the event `event_id` has bindings.
+     */
+    bool HasBindingsForEvent(uint32 event_id) const
+    {
+        return event_id < event_key_counts.size() && event_key_counts[event_id] != 0;
+    }
+
     /*
      * Push all Lua references for `key` onto the stack.
      */
@@ -179,10 +264,11 @@ public:
             return;
 
         BindingList& list = result->second;
+        bool bound = !list.empty();
+
         for (auto i = list.begin(); i != list.end();)
         {
             std::unique_ptr<Binding>& binding = (*i);
-            auto i_prev = (i++);
 
             lua_rawgeti(L, LUA_REGISTRYINDEX, binding->functionReference);
 
@@ -193,10 +279,17 @@ public:
                 if (binding->remainingShots == 0)
                 {
                     id_lookup_table.erase(binding->id);
-                    list.erase(i_prev);
+                    // erasing from the vector invalidates the following iterators
+                    i = list.erase(i);
+                    continue;
                 }
             }
+
+            ++i;
         }
+
+        if (bound && list.empty())
+            SetKeyBound(key, false);
     }
 };
 
@@ -32,6 +32,7 @@ void ElunaConfig::Initialize()
     SetConfig(CONFIG_ELUNA_COMPATIBILITY_MODE, "Eluna.CompatibilityMode", false);
     SetConfig(CONFIG_ELUNA_TRACEBACK, "Eluna.TraceBack", false);
     SetConfig(CONFIG_ELUNA_SCRIPT_RELOADER, "Eluna.ScriptReloader", false);
+    SetConfig(CONFIG_ELUNA_COMPATIBILITY_MAP_THREADS, "Eluna.CompatibilityMapThreads", false);
 
     // Load strings
     SetConfig(CONFIG_ELUNA_SCRIPT_PATH, "Eluna.ScriptPath", "lua_scripts");
@@ -73,6 +74,11 @@ bool ElunaConfig::IsElunaCompatibilityMode()
     return GetConfig(CONFIG_ELUNA_COMPATIBILITY_MODE);
 }
 
+bool ElunaConfig::IsElunaCompatibilityMapThreads()
+{
+    return IsElunaCompatibilityMode() && GetConfig(CONFIG_ELUNA_COMPATIBILITY_MAP_THREADS);
+}
+
 bool ElunaConfig::ShouldMapLoadEluna(uint32 id)
 {
     // if the set is empty (all maps), return true
@@ -15,6 +15,7 @@ enum ElunaConfigBoolValues
     CONFIG_ELUNA_COMPATIBILITY_MODE,
     CONFIG_ELUNA_TRACEBACK,
     CONFIG_ELUNA_SCRIPT_RELOADER,
+    CONFIG_ELUNA_COMPATIBILITY_MAP_THREADS,
     CONFIG_ELUNA_BOOL_COUNT
 };
 
@@ -47,6 +48,7 @@ public:
 
     bool IsElunaEnabled();
     bool IsElunaCompatibilityMode();
+    bool IsElunaCompatibilityMapThreads();
     bool ShouldMapLoadEluna(uint32 mapId);
 
 private:
@@ -21,22 +21,38 @@ extern "C"
 ElunaEventProcessor::ElunaEventProcessor(Eluna* _E, WorldObject* _obj) : m_time(0), obj(_obj), E(_E)
 {
     if (obj)
+    {
+        std::lock_guard<std::mutex> guard(E->eventMgr->processorsLock);
         E->eventMgr->processors.insert(this);
+    }
 }
 
 ElunaEventProcessor::~ElunaEventProcessor()
 {
+    // only events hold lua references
+    if (!eventList.empty())
     {
+        auto stateGuard = E->LockState();
         RemoveEvents_internal();
     }
 
     if (obj)
+    {
+        std::lock_guard<std::mutex> guard(E->eventMgr->processorsLock);
         E->eventMgr->processors.erase(this);
+    }
 }
 
 void ElunaEventProcessor::Update(uint32 diff)
 {
     m_time += diff;
+
+    // a shared state is only waited for when an event is due
+    if (eventList.empty() || eventList.begin()->first > m_time)
+        return;
+
+    auto stateGuard = E->LockState();
+
     for (EventList::iterator it = eventList.begin(); it != eventList.end() && it->first <= m_time; it = eventList.begin())
     {
         LuaEvent* luaEvent = it->second;
@@ -119,6 +135,7 @@ EventMgr::EventMgr(Eluna* _E) : globalProcessor(new ElunaEventProcessor(_E, NULL
 EventMgr::~EventMgr()
 {
     {
+        std::lock_guard<std::mutex> guard(processorsLock);
         if (!processors.empty())
             for (ProcessorSet::const_iterator it = processors.begin(); it != processors.end(); ++it) // loop processors
                 (*it)->RemoveEvents_internal();
@@ -130,6 +147,7 @@ EventMgr::~EventMgr()
 
 void EventMgr::SetStates(LuaEventState state)
 {
+    std::lock_guard<std::mutex> guard(processorsLock);
     if (!processors.empty())
         for (ProcessorSet::const_iterator it = processors.begin(); it != processors.end(); ++it) // loop processors
             (*it)->SetStates(state);
@@ -138,6 +156,7 @@ void EventMgr::SetStates(LuaEventState state)
 
 void EventMgr::SetState(int eventId, LuaEventState state)
 {
+    std::lock_guard<std::mutex> guard(processorsLock);
     if (!processors.empty())
         for (ProcessorSet::const_iterator it = processors.begin(); it != processors.end(); ++it) // loop processors
             (*it)->SetState(eventId, state);
@@ -17,6 +17,7 @@
 #include "Util.h"
 #endif
 #include <map>
+#include <mutex>
 
 #if defined ELUNA_TRINITY
 #include "Define.h"
@@ -96,6 +97,8 @@ class EventMgr
 public:
     typedef std::unordered_set<ElunaEventProcessor*> ProcessorSet;
     ProcessorSet processors;
+    // Objects of several map update threads register in a shared state
+    std::mutex processorsLock;
     ElunaEventProcessor* globalProcessor;
     Eluna* E;
 
@@ -12,6 +12,8 @@
 #if !defined ELUNA_TRINITY
 void ElunaInstanceAI::Initialize()
 {
+    auto stateGuard = instance->GetEluna()->LockState();
+
     ASSERT(!instance->GetEluna()->HasInstanceData(instance));
 
     // Create a new table for instance data.
@@ -25,6 +27,8 @@ void ElunaInstanceAI::Initialize()
 
 void ElunaInstanceAI::Load(const char* data)
 {
+    auto stateGuard = instance->GetEluna()->LockState();
+
     // If we get passed NULL (i.e. `Reload` was called) then use
     //   the last known save data (or maybe just an empty string).
     if (!data)
@@ -111,6 +115,8 @@ void ElunaInstanceAI::Load(const char* data)
 
 const char* ElunaInstanceAI::Save() const
 {
+    auto stateGuard = instance->GetEluna()->LockState();
+
     lua_State* L = instance->GetEluna()->L;
     // Stack: (empty)
 
@@ -149,6 +155,7 @@ const char* ElunaInstanceAI::Save() const
 uint32 ElunaInstanceAI::GetData(uint32 key) const
 {
     Eluna* E = instance->GetEluna();
+    auto stateGuard = E->LockState();
     lua_State* L = E->L;
     // Stack: (empty)
 
@@ -171,6 +178,7 @@ uint32 ElunaInstanceAI::GetData(uint32 key) const
 void ElunaInstanceAI::SetData(uint32 key, uint32 value)
 {
     Eluna* E = instance->GetEluna();
+    auto stateGuard = E->LockState();
     lua_State* L = E->L;
     // Stack: (empty)
 
@@ -191,6 +199,7 @@ void ElunaInstanceAI::SetData(uint32 key, uint32 value)
 uint64 ElunaInstanceAI::GetData64(uint32 key) const
 {
     Eluna* E = instance->GetEluna();
+    auto stateGuard = E->LockState();
     lua_State* L = E->L;
     // Stack: (empty)
 
@@ -213,6 +222,7 @@ uint64 ElunaInstanceAI::GetData64(uint32 key) const
 void ElunaInstanceAI::SetData64(uint32 key, uint64 value)
 {
     Eluna* E = instance->GetEluna();
+    auto stateGuard = E->LockState();
     lua_State* L = E->L;
     // Stack: (empty)
 
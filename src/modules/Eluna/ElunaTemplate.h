@@ -422,6 +422,10 @@ public:
         ElunaRegister<T>* l = static_cast<ElunaRegister<T>*>(lua_touserdata(L, lua_upvalueindex(1)));
         Eluna* E = Eluna::GetEluna(L);
 
+        // world state methods reach into the other maps
+        if (l->regState == METHOD_REG_WORLD && E->IsInMapUpdate())
+            return luaL_error(L, "attempt to call world state method '%s' from a map update", l->name);
+
         // determine if the method table functions are global or non-global
         constexpr bool isGlobal = std::is_same_v<T, void>;
 
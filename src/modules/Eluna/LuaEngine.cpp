@@ -16,6 +16,9 @@
 #include "ElunaUtility.h"
 #include "ElunaCreatureAI.h"
 #include "ElunaInstanceAI.h"
+#if defined ELUNA_MANGOS
+#include "TickProfiler.h"
+#endif
 
 extern "C"
 {
@@ -29,11 +32,25 @@ extern "C"
 
 extern void RegisterMethods(Eluna* E);
 
+thread_local ElunaHookRecord* Eluna::hookRecord = NULL;
+// The shared state whose map update runs on this thread, see Eluna::MapUpdateScope
+static thread_local Eluna* mapUpdateState = NULL;
+static thread_local Map const* updatedMap = NULL;
+// The shared state this thread owns and the number of nested Eluna::AcquireState calls
+static thread_local Eluna* ownedState = NULL;
+static thread_local uint32 ownedStateDepth = 0;
+
 void Eluna::_ReloadEluna()
 {
     // Remove all timed events
     eventMgr->SetStates(LUAEVENT_STATE_ERASE);
 
+    // Remove deferred hooks, they use the bindings of the old state
+    {
+        std::lock_guard<std::mutex> guard(queuedHooksLock);
+        queuedHooks.clear();
+    }
+
     // Close lua
     CloseLua();
 
@@ -51,6 +68,10 @@ event_level(0),
 push_counter(0),
 boundMap(map),
 compatibilityMode(compatMode),
+sharedState(compatMode && sElunaConfig->IsElunaCompatibilityMapThreads()),
+runningMapUpdates(0),
+waitingForState(0),
+stateOwned(false),
 
 L(NULL),
 eventMgr(NULL),
@@ -364,6 +385,21 @@ bool Eluna::ExecuteCall(int params, int res)
         ASSERT(false); // stack probably corrupt
     }
 
+#if defined ELUNA_MANGOS
+    // Call cost per Lua function, identified by its script and first line
+    bool profile = sTickProfiler.IsLuaProfilingEnabled();
+    std::string profiledFunction;
+    TickProfiler::Clock::time_point profileStart;
+    if (profile)
+    {
+        lua_Debug ar;
+        lua_pushvalue(L, base);
+        lua_getinfo(L, ">S", &ar);
+        profiledFunction = std::string(ar.short_src) + ":" + std::to_string(ar.linedefined);
+        profileStart = TickProfiler::Clock::now();
+    }
+#endif
+
     bool usetrace = sElunaConfig->GetConfig(CONFIG_ELUNA_TRACEBACK);
     if (usetrace)
     {
@@ -378,6 +414,11 @@ bool Eluna::ExecuteCall(int params, int res)
     int result = lua_pcall(L, params, res, usetrace ? base : 0);
     --event_level;
 
+#if defined ELUNA_MANGOS
+    if (profile)
+        sTickProfiler.AddLuaCallTime(profiledFunction, TickProfiler::ElapsedUs(profileStart));
+#endif
+
     if (usetrace)
     {
         // Stack: traceback, [results or errmsg]
@@ -539,6 +580,154 @@ void Eluna::Push(ObjectGuid const guid)
     ElunaTemplate<ObjectGuid>::Push(this, &guid);
 }
 
+static bool PushNilLater(Eluna* E)
+{
+    E->Push();
+    return true;
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(const char* value)
+{
+    if (!value)
+        return &PushNilLater;
+
+    std::string copy(value);
+    return [copy](Eluna* E) { E->Push(copy); return true; };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Player const* player)
+{
+    if (!player)
+        return &PushNilLater;
+
+    // the player may have changed maps in the meantime
+    ObjectGuid guid = player->GET_GUID();
+    return [guid](Eluna* E)
+    {
+        Player* current = eObjectAccessor()FindPlayer(guid);
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(WorldObject const* obj)
+{
+    if (!obj)
+        return &PushNilLater;
+
+    if (obj->GetTypeId() == TYPEID_PLAYER)
+        return PushLater(static_cast<Player const*>(obj));
+
+    ObjectGuid guid = obj->GET_GUID();
+    uint32 mapId = obj->GetMapId();
+    uint32 instanceId = obj->GetInstanceId();
+    return [guid, mapId, instanceId](Eluna* E)
+    {
+        Map* map = eMapMgr->FindMap(mapId, instanceId);
+        WorldObject* current = map ? map->GetWorldObject(guid) : NULL;
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Unit const* unit)
+{
+    return PushLater(static_cast<WorldObject const*>(unit));
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Creature const* creature)
+{
+    return PushLater(static_cast<WorldObject const*>(creature));
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(GameObject const* gameobject)
+{
+    return PushLater(static_cast<WorldObject const*>(gameobject));
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Item const* item)
+{
+    if (!item)
+        return &PushNilLater;
+
+    ObjectGuid guid = item->GET_GUID();
+    ObjectGuid ownerGuid = item->GetOwnerGuid();
+    return [guid, ownerGuid](Eluna* E)
+    {
+        Player* owner = eObjectAccessor()FindPlayer(ownerGuid);
+        Item* current = owner ? owner->GetItemByGuid(guid) : NULL;
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Guild const* guild)
+{
+    if (!guild)
+        return &PushNilLater;
+
+    uint32 guildId = const_cast<Guild*>(guild)->GetId();
+    return [guildId](Eluna* E)
+    {
+        Guild* current = eGuildMgr->GetGuildById(guildId);
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Group const* group)
+{
+    if (!group)
+        return &PushNilLater;
+
+    uint32 groupId = group->GetId();
+    return [groupId](Eluna* E)
+    {
+        Group* current = eObjectMgr->GetGroupById(groupId);
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Map const* map)
+{
+    if (!map)
+        return &PushNilLater;
+
+    uint32 mapId = map->GetId();
+    uint32 instanceId = map->GetInstanceId();
+    return [mapId, instanceId](Eluna* E)
+    {
+        Map* current = eMapMgr->FindMap(mapId, instanceId);
+        if (!current)
+            return false;
+
+        E->Push(current);
+        return true;
+    };
+}
+
+std::function<bool(Eluna*)> Eluna::PushLater(Quest const* quest)
+{
+    // quest templates are not freed while the server runs
+    return [quest](Eluna* E) { E->Push(quest); return true; };
+}
+
 static int CheckIntegerRange(lua_State* luastate, int narg, int min, int max)
 {
     double value = luaL_checknumber(luastate, narg);
@@ -986,6 +1175,8 @@ int Eluna::Register(uint8 regtype, uint32 entry, ObjectGuid guid, uint32 instanc
 
 void Eluna::UpdateEluna(uint32 diff)
 {
+    auto stateGuard = LockState();
+
     if (reload && sElunaLoader->GetCacheState() == SCRIPT_CACHE_READY)
 #if defined ELUNA_TRINITY
         if(!GetQueryProcessor().HasPendingCallbacks())
@@ -998,6 +1189,177 @@ void Eluna::UpdateEluna(uint32 diff)
 #endif
 }
 
+void Eluna::QueueHook(std::function<void()> const& hook)
+{
+    std::lock_guard<std::mutex> guard(queuedHooksLock);
+    queuedHooks.push_back(hook);
+}
+
+void Eluna::RunQueuedHooks()
+{
+    std::vector<std::function<void()> > hooks;
+    {
+        std::lock_guard<std::mutex> guard(queuedHooksLock);
+        hooks.swap(queuedHooks);
+    }
+
+    if (hooks.empty())
+        return;
+
+    auto stateGuard = LockState();
+
+    for (std::function<void()>& hook : hooks)
+        hook();
+}
+
+void Eluna::AcquireState()
+{
+    if (ownedState == this)
+    {
+        ++ownedStateDepth;
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> guard(syncLock);
+
+        // a map update waiting for the state is at a safe point
+        if (mapUpdateState == this)
+        {
+            --runningMapUpdates;
+            syncCond.notify_all();
+        }
+
+        ++waitingForState;
+        syncCond.wait(guard, [this] { return !stateOwned && !runningMapUpdates; });
+        --waitingForState;
+        stateOwned = true;
+    }
+
+    bindingsLock.lock();
+    ownedState = this;
+    ownedStateDepth = 1;
+}
+
+void Eluna::ReleaseState()
+{
+    if (--ownedStateDepth)
+        return;
+
+    ownedState = NULL;
+    bindingsLock.unlock();
+
+    std::lock_guard<std::mutex> guard(syncLock);
+    stateOwned = false;
+    if (mapUpdateState == this)
+        ++runningMapUpdates;
+    syncCond.notify_all();
+}
+
+void Eluna::BeginMapUpdate(Map const* map)
+{
+    std::unique_lock<std::mutex> guard(syncLock);
+
+    // let the waiting threads in first, they wait for the running updates to pause
+    syncCond.wait(guard, [this] { return !stateOwned && !waitingForState; });
+    ++runningMapUpdates;
+    mapUpdateState = this;
+    updatedMap = map;
+}
+
+void Eluna::EndMapUpdate()
+{
+    std::lock_guard<std::mutex> guard(syncLock);
+    --runningMapUpdates;
+    mapUpdateState = NULL;
+    updatedMap = NULL;
+    syncCond.notify_all();
+}
+
+bool Eluna::IsInMapUpdate() const
+{
+    return mapUpdateState == this;
+}
+
+bool Eluna::IsAccessibleMap(Map const* map) const
+{
+    return mapUpdateState != this || map == updatedMap;
+}
+
+std::unique_lock<std::mutex> Eluna::LockBindings()
+{
+    if (!sharedState || mapUpdateState == this || ownedState == this)
+        return std::unique_lock<std::mutex>();
+
+    return std::unique_lock<std::mutex>(bindingsLock);
+}
+
+Eluna::HookScope::HookScope(Eluna* _E, std::unique_lock<std::mutex>& bindingsGuard) : E(_E->IsSharedState() ? _E : NULL), acquired(false)
+{
+    if (!E)
+        return;
+
+    if (bindingsGuard.owns_lock())
+        bindingsGuard.unlock();
+
+    if (mapUpdateState == E && ownedState != E)
+    {
+        ASSERT(!hookRecord);
+        hookRecord = &record;
+    }
+    else
+    {
+        E->AcquireState();
+        acquired = true;
+    }
+}
+
+Eluna::HookScope::~HookScope()
+{
+    if (!E)
+        return;
+
+    if (hookRecord == &record)
+        hookRecord = NULL;
+
+    if (acquired || record.flushed)
+        E->ReleaseState();
+}
+
+void Eluna::FlushHookArguments()
+{
+    if (!hookRecord)
+        return;
+
+    ElunaHookRecord* record = hookRecord;
+    hookRecord = NULL;
+
+    AcquireState();
+    record->flushed = true;
+
+    for (ElunaHookArgument const& argument : record->arguments)
+        argument.push(this);
+    push_counter = record->arguments.size();
+}
+
+bool Eluna::PushHookArgumentsLater(ElunaHookArguments const& arguments)
+{
+    int top = lua_gettop(L);
+
+    for (ElunaHookArgument const& argument : arguments)
+    {
+        if (!argument.pushLater(this))
+        {
+            // an object of the hook is gone
+            lua_settop(L, top);
+            return false;
+        }
+    }
+
+    push_counter = arguments.size();
+    return true;
+}
+
 /*
  * Cleans up the stack, effectively undoing all Push calls and the Setup call.
  */
@@ -1046,6 +1408,8 @@ int Eluna::CallOneFunction(int number_of_functions, int number_of_arguments, int
 
 CreatureAI* Eluna::GetAI(Creature* creature)
 {
+    auto bindingsGuard = LockBindings();
+
     for (int i = 1; i < Hooks::CREATURE_EVENT_COUNT; ++i)
     {
         Hooks::CreatureEvents event_id = (Hooks::CreatureEvents)i;
@@ -1063,6 +1427,8 @@ CreatureAI* Eluna::GetAI(Creature* creature)
 
 InstanceData* Eluna::GetInstanceData(Map* map)
 {
+    auto bindingsGuard = LockBindings();
+
     for (int i = 1; i < Hooks::INSTANCE_EVENT_COUNT; ++i)
     {
         Hooks::InstanceEvents event_id = (Hooks::InstanceEvents)i;
@@ -1124,6 +1490,8 @@ void Eluna::CreateInstanceData(Map const* map)
  */
 void Eluna::FreeInstanceId(uint32 instanceId)
 {
+    auto stateGuard = LockState();
+
     for (int i = 1; i < Hooks::INSTANCE_EVENT_COUNT; ++i)
     {
         auto key = EntryKey<Hooks::InstanceEvents>((Hooks::InstanceEvents)i, instanceId);
@@ -1144,6 +1512,25 @@ void Eluna::FreeInstanceId(uint32 instanceId)
 
 void Eluna::PushInstanceData(ElunaInstanceAI* ai, bool incrementCounter)
 {
+    // Recorded hook argument, see HookScope
+    if (incrementCounter && hookRecord)
+    {
+        uint32 mapId = ai->instance->GetId();
+        uint32 instanceId = ai->instance->GetInstanceId();
+
+        hookRecord->arguments.push_back({ [ai](Eluna* E) { E->PushInstanceData(ai, false); }, [mapId, instanceId](Eluna* E)
+        {
+            Map* map = eMapMgr->FindMap(mapId, instanceId);
+            ElunaInstanceAI* current = map ? dynamic_cast<ElunaInstanceAI*>(map->GetInstanceData()) : NULL;
+            if (!current)
+                return false;
+
+            E->PushInstanceData(current, false);
+            return true;
+        } });
+        return;
+    }
+
     // Check if the instance data is missing (i.e. someone reloaded Eluna).
     if (!HasInstanceData(ai->instance))
         ai->Reload();
@@ -33,6 +33,8 @@
 #include "Entities/Player.h"
 #endif
 
+#include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <memory>
 
@@ -110,6 +112,26 @@ template<typename T> struct EventKey;
 template<typename T> struct EntryKey;
 template<typename T> struct UniqueObjectKey;
 
+/*
+ * An argument of a hook call recorded on a map update thread of a shared state.
+ * `push` pushes the argument as it was passed to the hook. `pushLater` looks it up
+ *   again on the world thread and returns false if it is gone. Arguments that can
+ *   not be looked up again have no `pushLater`, their hook is not deferred.
+ */
+struct ElunaHookArgument
+{
+    std::function<void(Eluna*)> push;
+    std::function<bool(Eluna*)> pushLater;
+};
+typedef std::vector<ElunaHookArgument> ElunaHookArguments;
+
+struct ElunaHookRecord
+{
+    ElunaHookArguments arguments;
+    // The arguments were pushed to call the hook immediately, the state is held for it.
+    bool flushed = false;
+};
+
 struct LuaScript
 {
     std::string fileext;
@@ -173,6 +195,25 @@ private:
 
     // Whether or not Eluna is in compatibility mode. Used in some method wrappers.
     bool compatibilityMode;
+    // Whether the compatibility mode state is used by several map update threads.
+    // Lua code then only runs while all of those updates are paused at a safe point, see AcquireState.
+    bool sharedState;
+    std::mutex syncLock;
+    std::condition_variable syncCond;
+    // Map updates of the state that are not paused at a safe point
+    uint32 runningMapUpdates;
+    // Threads waiting in AcquireState
+    uint32 waitingForState;
+    bool stateOwned;
+    // Held by the thread that owns the state, see LockBindings
+    std::mutex bindingsLock;
+
+    // Hooks deferred by map threads, run by the world thread after the map updates
+    std::vector<std::function<void()> > queuedHooks;
+    std::mutex queuedHooksLock;
+
+    // The hook call recorded by this thread, see HookScope
+    static thread_local ElunaHookRecord* hookRecord;
 
     // Map from instance ID -> Lua table ref
     std::unordered_map<uint32, int> instanceDataRefs;
@@ -199,6 +240,8 @@ private:
     template<typename T>               void ReplaceArgument(T value, uint8 index);
     template<typename K1, typename K2> void CallAllFunctions(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2);
     template<typename K1, typename K2> bool CallAllFunctionsBool(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2, bool default_value = false);
+    template<typename K1, typename K2> void CallAllFunctionsNow(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2);
+    template<typename K1, typename K2> bool DeferHook(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2);
 
     // Same as above but for only one binding instead of two.
     // `key` is passed twice because there's no NULL for references, but it's not actually used if `bindings2` is NULL.
@@ -214,24 +257,117 @@ private:
     {
         return CallAllFunctionsBool<K, K>(bindings, NULL, key, key, default_value);
     }
+    template<typename K> void CallAllFunctionsNow(BindingMap<K>* bindings, const K& key)
+    {
+        CallAllFunctionsNow<K, K>(bindings, NULL, key, key);
+    }
 
     // Non-static pushes, to be used in hooks.
     // They up the pushed value counter for hook helper functions.
-    void HookPush()                                 { Push(); ++push_counter; }
-    void HookPush(const long long value)            { Push(value); ++push_counter; }
-    void HookPush(const unsigned long long value)   { Push(value); ++push_counter; }
-    void HookPush(const long value)                 { Push(value); ++push_counter; }
-    void HookPush(const unsigned long value)        { Push(value); ++push_counter; }
-    void HookPush(const int value)                  { Push(value); ++push_counter; }
-    void HookPush(const unsigned int value)         { Push(value); ++push_counter; }
-    void HookPush(const bool value)                 { Push(value); ++push_counter; }
-    void HookPush(const float value)                { Push(value); ++push_counter; }
-    void HookPush(const double value)               { Push(value); ++push_counter; }
-    void HookPush(const std::string& value)         { Push(value); ++push_counter; }
-    void HookPush(const char* value)                { Push(value); ++push_counter; }
-    void HookPush(ObjectGuid const value)           { Push(value); ++push_counter; }
+    // While a hook call is recorded, see HookScope, the values are recorded instead.
+    void HookPush()
+    {
+        if (hookRecord)
+            hookRecord->arguments.push_back({ [](Eluna* E) { E->Push(); }, [](Eluna* E) { E->Push(); return true; } });
+        else
+        {
+            Push();
+            ++push_counter;
+        }
+    }
+    void HookPush(const long long value)            { HookPushValue(value); }
+    void HookPush(const unsigned long long value)   { HookPushValue(value); }
+    void HookPush(const long value)                 { HookPushValue(value); }
+    void HookPush(const unsigned long value)        { HookPushValue(value); }
+    void HookPush(const int value)                  { HookPushValue(value); }
+    void HookPush(const unsigned int value)         { HookPushValue(value); }
+    void HookPush(const bool value)                 { HookPushValue(value); }
+    void HookPush(const float value)                { HookPushValue(value); }
+    void HookPush(const double value)               { HookPushValue(value); }
+    void HookPush(const std::string& value)         { HookPushValue(value); }
+    void HookPush(const char* value)                { HookPushValue(value); }
+    void HookPush(ObjectGuid const value)           { HookPushValue(value); }
     template<typename T>
-    void HookPush(T const* ptr)                     { Push(ptr); ++push_counter; }
+    void HookPush(T const* ptr)                     { HookPushValue(ptr); }
+
+    template<typename T>
+    void HookPushValue(T const& value)
+    {
+        if (hookRecord)
+            hookRecord->arguments.push_back({ [value](Eluna* E) { E->Push(value); }, PushLater(value) });
+        else
+        {
+            Push(value);
+            ++push_counter;
+        }
+    }
+
+    // Look a recorded hook argument up again on the world thread, see ElunaHookArgument.
+    // Values are copied, objects are looked up by their GUID or ID and data that is
+    //   never freed keeps its pointer. Other pointers can not be looked up.
+    template<typename T>
+    static std::function<bool(Eluna*)> PushLater(T value)
+    {
+        return [value](Eluna* E) { E->Push(value); return true; };
+    }
+    template<typename T>
+    static std::function<bool(Eluna*)> PushLater(T const* /*ptr*/) { return std::function<bool(Eluna*)>(); }
+    static std::function<bool(Eluna*)> PushLater(const char* value);
+    static std::function<bool(Eluna*)> PushLater(Player const* player);
+    static std::function<bool(Eluna*)> PushLater(WorldObject const* obj);
+    static std::function<bool(Eluna*)> PushLater(Unit const* unit);
+    static std::function<bool(Eluna*)> PushLater(Creature const* creature);
+    static std::function<bool(Eluna*)> PushLater(GameObject const* gameobject);
+    static std::function<bool(Eluna*)> PushLater(Item const* item);
+    static std::function<bool(Eluna*)> PushLater(Guild const* guild);
+    static std::function<bool(Eluna*)> PushLater(Group const* group);
+    static std::function<bool(Eluna*)> PushLater(Map const* map);
+    static std::function<bool(Eluna*)> PushLater(Quest const* quest);
+
+    /*
+     * Entered by the hooks after their bindings were found.
+     * The thread waits for a shared state, see AcquireState. A map update thread
+     *   records the hook arguments instead. CallAllFunctions then defers the hook
+     *   to the world thread, hooks that use the results push the arguments and
+     *   wait for the state, see FlushHookArguments.
+     */
+    class HookScope
+    {
+    public:
+        HookScope(Eluna* _E, std::unique_lock<std::mutex>& bindingsGuard);
+        ~HookScope();
+
+        HookScope(HookScope const&) = delete;
+        HookScope& operator=(HookScope const&) = delete;
+
+    private:
+        Eluna* E;
+        bool acquired;
+        ElunaHookRecord record;
+    };
+
+    // Binding lookups of hooks are only safe while no lua code runs. Map update threads
+    //   only run while the state is not owned, other threads lock the bindings.
+    std::unique_lock<std::mutex> LockBindings();
+    // Pushes the recorded hook arguments and waits for the state to call the hook now
+    void FlushHookArguments();
+    // The stack top after the hook arguments, used by hooks that replace them
+    int HookArgumentsTop()
+    {
+        FlushHookArguments();
+        return lua_gettop(L);
+    }
+    bool PushHookArgumentsLater(ElunaHookArguments const& arguments);
+    void QueueHook(std::function<void()> const& hook);
+
+    // Wait until every map update of a shared state is paused at a safe point,
+    //   i.e. waits in here or has finished, then own the state. Nested calls of
+    //   the owner return immediately. A hook call site is a safe point, the map
+    //   update already allows any lua code there.
+    void AcquireState();
+    void ReleaseState();
+    void BeginMapUpdate(Map const* map);
+    void EndMapUpdate();
 
 public:
 
@@ -371,6 +507,61 @@ public:
     }
 
     bool GetCompatibilityMode() const { return compatibilityMode; }
+    bool IsSharedState() const { return sharedState; }
+
+    // Holds a shared state, see AcquireState, and does nothing otherwise
+    class StateGuard
+    {
+    public:
+        explicit StateGuard(Eluna* _E) : E(_E->IsSharedState() ? _E : NULL)
+        {
+            if (E)
+                E->AcquireState();
+        }
+        ~StateGuard()
+        {
+            if (E)
+                E->ReleaseState();
+        }
+
+        StateGuard(StateGuard const&) = delete;
+        StateGuard& operator=(StateGuard const&) = delete;
+
+    private:
+        Eluna* E;
+    };
+
+    // Counts a map update of a shared state while it runs on a map update thread
+    class MapUpdateScope
+    {
+    public:
+        MapUpdateScope(Eluna* _E, Map const* map) : E(_E && _E->IsSharedState() ? _E : NULL)
+        {
+            if (E)
+                E->BeginMapUpdate(map);
+        }
+        ~MapUpdateScope()
+        {
+            if (E)
+                E->EndMapUpdate();
+        }
+
+        MapUpdateScope(MapUpdateScope const&) = delete;
+        MapUpdateScope& operator=(MapUpdateScope const&) = delete;
+
+    private:
+        Eluna* E;
+    };
+
+    StateGuard LockState() { return StateGuard(this); }
+
+    // Lua code run by a map update of a shared state, see MapUpdateScope, may only access
+    //   the updated map. The other maps are paused in the middle of their update.
+    bool IsInMapUpdate() const;
+    bool IsAccessibleMap(Map const* map) const;
+
+    // Runs the hooks deferred by the map update threads, see HookScope
+    void RunQueuedHooks();
 
     Eluna(Map * map, bool compatMode = false);
     ~Eluna();
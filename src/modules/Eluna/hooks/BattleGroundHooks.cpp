@@ -13,9 +13,11 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<BGEvents>(EVENT);\
     if (!BGEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnBGStart(BattleGround* bg, BattleGroundTypeId bgId, uint32 instanceId)
 {
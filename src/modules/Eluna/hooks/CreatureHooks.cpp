@@ -14,18 +14,22 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT, CREATURE) \
+    auto bindingsGuard = LockBindings();\
     auto entry_key = EntryKey<CreatureEvents>(EVENT, CREATURE->GetEntry());\
     auto unique_key = UniqueObjectKey<CreatureEvents>(EVENT, CREATURE->GET_GUID(), CREATURE->GetInstanceId());\
     if (!CreatureEventBindings->HasBindingsFor(entry_key))\
         if (!CreatureUniqueBindings->HasBindingsFor(unique_key))\
-            return;
+            return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, CREATURE, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto entry_key = EntryKey<CreatureEvents>(EVENT, CREATURE->GetEntry());\
     auto unique_key = UniqueObjectKey<CreatureEvents>(EVENT, CREATURE->GET_GUID(), CREATURE->GetInstanceId());\
     if (!CreatureEventBindings->HasBindingsFor(entry_key))\
         if (!CreatureUniqueBindings->HasBindingsFor(unique_key))\
-            return RETVAL;
+            return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnDummyEffect(WorldObject* pCaster, uint32 spellId, SpellEffIndex effIndex, Creature* pTarget)
 {
@@ -75,7 +79,7 @@ void Eluna::OnRemoveFromWorld(Creature* pCreature)
 {
     START_HOOK(CREATURE_EVENT_ON_REMOVE, pCreature);
     HookPush(pCreature);
-    CallAllFunctions(CreatureEventBindings, CreatureUniqueBindings, entry_key, unique_key);
+    CallAllFunctionsNow(CreatureEventBindings, CreatureUniqueBindings, entry_key, unique_key);
 }
 
 bool Eluna::OnSummoned(Creature* pCreature, Unit* pSummoner)
@@ -112,7 +116,7 @@ bool Eluna::DamageTaken(Creature* me, Unit* attacker, uint32& damage)
     HookPush(me);
     HookPush(attacker);
     HookPush(damage);
-    int damageIndex = lua_gettop(L);
+    int damageIndex = HookArgumentsTop();
     int n = SetupStack(CreatureEventBindings, CreatureUniqueBindings, entry_key, unique_key, 3);
 
     while (n > 0)
@@ -235,7 +239,7 @@ bool Eluna::CorpseRemoved(Creature* me, uint32& respawnDelay)
     bool result = false;
     HookPush(me);
     HookPush(respawnDelay);
-    int respawnDelayIndex = lua_gettop(L);
+    int respawnDelayIndex = HookArgumentsTop();
     int n = SetupStack(CreatureEventBindings, CreatureUniqueBindings, entry_key, unique_key, 2);
 
     while (n > 0)
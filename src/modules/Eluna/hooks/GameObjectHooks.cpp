@@ -15,14 +15,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT, ENTRY) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<GameObjectEvents>(EVENT, ENTRY);\
     if (!GameObjectEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, ENTRY, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<GameObjectEvents>(EVENT, ENTRY);\
     if (!GameObjectEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnDummyEffect(WorldObject* pCaster, uint32 spellId, SpellEffIndex effIndex, GameObject* pTarget)
 {
@@ -121,7 +125,7 @@ void Eluna::OnRemoveFromWorld(GameObject* pGameObject)
 {
     START_HOOK(GAMEOBJECT_EVENT_ON_REMOVE, pGameObject->GetEntry());
     HookPush(pGameObject);
-    CallAllFunctions(GameObjectEventBindings, key);
+    CallAllFunctionsNow(GameObjectEventBindings, key);
 }
 
 bool Eluna::OnGameObjectUse(Player* pPlayer, GameObject* pGameObject)
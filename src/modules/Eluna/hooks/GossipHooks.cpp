@@ -14,14 +14,18 @@
 using namespace Hooks;
 
 #define START_HOOK(BINDINGS, EVENT, ENTRY) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<GossipEvents>(EVENT, ENTRY);\
     if (!BINDINGS->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(BINDINGS, EVENT, ENTRY, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<GossipEvents>(EVENT, ENTRY);\
     if (!BINDINGS->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 bool Eluna::OnGossipHello(Player* pPlayer, GameObject* pGameObject)
 {
@@ -13,14 +13,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<GroupEvents>(EVENT);\
     if (!GroupEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<GroupEvents>(EVENT);\
     if (!GroupEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnAddMember(Group* group, ObjectGuid guid)
 {
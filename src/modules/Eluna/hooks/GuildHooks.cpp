@@ -13,9 +13,11 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<GuildEvents>(EVENT);\
     if (!GuildEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnAddMember(Guild* guild, Player* player, uint32 plRank)
 {
@@ -74,7 +76,7 @@ void Eluna::OnMemberWitdrawMoney(Guild* guild, Player* player, uint32& amount, b
     HookPush(player);
     HookPush(amount);
     HookPush(isRepair); // isRepair not a part of Mangos, implement?
-    int amountIndex = lua_gettop(L) - 1;
+    int amountIndex = HookArgumentsTop() - 1;
     int n = SetupStack(GuildEventBindings, key, 4);
 
     while (n > 0)
@@ -102,7 +104,7 @@ void Eluna::OnMemberWitdrawMoney(Guild* guild, Player* player, uint64& amount, b
     HookPush(player);
     HookPush(amount);
     HookPush(isRepair); // isRepair not a part of Mangos, implement?
-    int amountIndex = lua_gettop(L) - 1;
+    int amountIndex = HookArgumentsTop() - 1;
     int n = SetupStack(GuildEventBindings, key, 4);
 
     while (n > 0)
@@ -129,7 +131,7 @@ void Eluna::OnMemberDepositMoney(Guild* guild, Player* player, uint32& amount)
     HookPush(guild);
     HookPush(player);
     HookPush(amount);
-    int amountIndex = lua_gettop(L);
+    int amountIndex = HookArgumentsTop();
     int n = SetupStack(GuildEventBindings, key, 3);
 
     while (n > 0)
@@ -156,7 +158,7 @@ void Eluna::OnMemberDepositMoney(Guild* guild, Player* player, uint64& amount)
     HookPush(guild);
     HookPush(player);
     HookPush(amount);
-    int amountIndex = lua_gettop(L);
+    int amountIndex = HookArgumentsTop();
     int n = SetupStack(GuildEventBindings, key, 3);
 
     while (n > 0)
@@ -18,6 +18,7 @@
 template<typename K1, typename K2>
 int Eluna::SetupStack(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2, int number_of_arguments)
 {
+    FlushHookArguments();
     ASSERT(number_of_arguments == this->push_counter);
     ASSERT(key1.event_id == key2.event_id);
     // Stack: [arguments]
@@ -59,12 +60,49 @@ void Eluna::ReplaceArgument(T value, uint8 index)
     // Stack: event_id, [arguments and value], [functions], [results]
 }
 
+/*
+ * Queues a hook call that was recorded on a map update thread, see HookScope,
+ *   for the world thread, which looks the arguments up again before the call.
+ * If an argument can not be looked up again they are pushed for an immediate call.
+ *
+ * Returns true if the call was queued.
+ */
+template<typename K1, typename K2>
+bool Eluna::DeferHook(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2)
+{
+    if (!hookRecord)
+        return false;
+
+    for (ElunaHookArgument const& argument : hookRecord->arguments)
+    {
+        if (!argument.pushLater)
+        {
+            FlushHookArguments();
+            return false;
+        }
+    }
+
+    ElunaHookArguments arguments;
+    arguments.swap(hookRecord->arguments);
+    hookRecord = NULL;
+
+    QueueHook([this, bindings1, bindings2, key1, key2, arguments]()
+    {
+        if (PushHookArgumentsLater(arguments))
+            CallAllFunctions(bindings1, bindings2, key1, key2);
+    });
+    return true;
+}
+
 /*
  * Call all event handlers registered to the event ID/entry combination and ignore any results.
  */
 template<typename K1, typename K2>
 void Eluna::CallAllFunctions(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2)
 {
+    if (DeferHook(bindings1, bindings2, key1, key2))
+        return;
+
     int number_of_arguments = this->push_counter;
     // Stack: [arguments]
 
@@ -83,6 +121,17 @@ void Eluna::CallAllFunctions(BindingMap<K1>* bindings1, BindingMap<K2>* bindings
     // Stack: (empty)
 }
 
+/*
+ * Same as `CallAllFunctions`, but never defers the call. Used by the hooks of objects
+ *   that are removed or destroyed afterwards, they can not be looked up again.
+ */
+template<typename K1, typename K2>
+void Eluna::CallAllFunctionsNow(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2)
+{
+    FlushHookArguments();
+    CallAllFunctions(bindings1, bindings2, key1, key2);
+}
+
 /*
  * Call all event handlers registered to the event ID/entry combination,
  *   and returns `default_value` if ALL event handlers returned `default_value`,
@@ -92,6 +141,7 @@ template<typename K1, typename K2>
 bool Eluna::CallAllFunctionsBool(BindingMap<K1>* bindings1, BindingMap<K2>* bindings2, const K1& key1, const K2& key2, bool default_value/* = false*/)
 {
     bool result = default_value;
+    FlushHookArguments();
     // Note: number_of_arguments here does not count in eventID, which is pushed in SetupStack
     int number_of_arguments = this->push_counter;
     // Stack: [arguments]
@@ -15,18 +15,22 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT, AI) \
+    auto bindingsGuard = LockBindings();\
     auto mapKey = EntryKey<InstanceEvents>(EVENT, AI->instance->GetId());\
     auto instanceKey = EntryKey<InstanceEvents>(EVENT, AI->instance->GetInstanceId());\
     if (!MapEventBindings->HasBindingsFor(mapKey) && !InstanceEventBindings->HasBindingsFor(instanceKey))\
         return;\
+    HookScope hookScope(this, bindingsGuard);\
     PushInstanceData(AI);\
     HookPush<Map>(AI->instance)
 
 #define START_HOOK_WITH_RETVAL(EVENT, AI, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto mapKey = EntryKey<InstanceEvents>(EVENT, AI->instance->GetId());\
     auto instanceKey = EntryKey<InstanceEvents>(EVENT, AI->instance->GetInstanceId());\
     if (!MapEventBindings->HasBindingsFor(mapKey) && !InstanceEventBindings->HasBindingsFor(instanceKey))\
         return RETVAL;\
+    HookScope hookScope(this, bindingsGuard);\
     PushInstanceData(AI);\
     HookPush<Map>(AI->instance)
 
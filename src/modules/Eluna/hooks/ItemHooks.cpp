@@ -14,14 +14,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT, ENTRY) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<ItemEvents>(EVENT, ENTRY);\
     if (!ItemEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, ENTRY, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<ItemEvents>(EVENT, ENTRY);\
     if (!ItemEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnDummyEffect(WorldObject* pCaster, uint32 spellId, SpellEffIndex effIndex, Item* pTarget)
 {
@@ -140,5 +144,5 @@ void Eluna::OnItemUnEquip(Player* pPlayer, Item* pItem, uint8 slot)
     HookPush(pPlayer);
     HookPush(pItem);
     HookPush(slot);
-    CallAllFunctions(ItemEventBindings, key);
+    CallAllFunctionsNow(ItemEventBindings, key);
 }
@@ -14,14 +14,18 @@
 using namespace Hooks;
 
 #define START_HOOK_SERVER(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<ServerEvents>(EVENT);\
     if (!ServerEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_PACKET(EVENT, OPCODE) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<PacketEvents>(EVENT, OPCODE);\
     if (!PacketEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 bool Eluna::OnPacketSend(WorldSession* session, const WorldPacket& packet)
 {
@@ -17,14 +17,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<PlayerEvents>(EVENT);\
     if (!PlayerEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<PlayerEvents>(EVENT);\
     if (!PlayerEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnLearnTalents(Player* pPlayer, uint32 talentId, uint32 talentRank, uint32 spellid)
 {
@@ -42,7 +46,7 @@ void Eluna::OnSkillChange(Player* pPlayer, uint32 skillId, uint32 skillValue)
     HookPush(pPlayer);
     HookPush(skillId);
     HookPush(skillValue);
-    int valueIndex = lua_gettop(L) - 1;
+    int valueIndex = HookArgumentsTop() - 1;
     int n = SetupStack(PlayerEventBindings, key, 3);
 
     while (n > 0)
@@ -260,7 +264,7 @@ void Eluna::OnMoneyChanged(Player* pPlayer, int32& amount)
     START_HOOK(PLAYER_EVENT_ON_MONEY_CHANGE);
     HookPush(pPlayer);
     HookPush(amount);
-    int amountIndex = lua_gettop(L);
+    int amountIndex = HookArgumentsTop();
     int n = SetupStack(PlayerEventBindings, key, 2);
 
     while (n > 0)
@@ -286,7 +290,7 @@ void Eluna::OnMoneyChanged(Player* pPlayer, int64& amount)
     START_HOOK(PLAYER_EVENT_ON_MONEY_CHANGE);
     HookPush(pPlayer);
     HookPush(amount);
-    int amountIndex = lua_gettop(L);
+    int amountIndex = HookArgumentsTop();
     int n = SetupStack(PlayerEventBindings, key, 2);
 
     while (n > 0)
@@ -313,7 +317,7 @@ void Eluna::OnGiveXP(Player* pPlayer, uint32& amount, Unit* pVictim)
     HookPush(pPlayer);
     HookPush(amount);
     HookPush(pVictim);
-    int amountIndex = lua_gettop(L) - 1;
+    int amountIndex = HookArgumentsTop() - 1;
     int n = SetupStack(PlayerEventBindings, key, 3);
 
     while (n > 0)
@@ -340,7 +344,7 @@ void Eluna::OnReputationChange(Player* pPlayer, uint32 factionID, int32& standin
     HookPush(factionID);
     HookPush(standing);
     HookPush(incremental);
-    int standingIndex = lua_gettop(L) - 1;
+    int standingIndex = HookArgumentsTop() - 1;
     int n = SetupStack(PlayerEventBindings, key, 4);
 
     while (n > 0)
@@ -423,7 +427,7 @@ void Eluna::OnLogout(Player* pPlayer)
 {
     START_HOOK(PLAYER_EVENT_ON_LOGOUT);
     HookPush(pPlayer);
-    CallAllFunctions(PlayerEventBindings, key);
+    CallAllFunctionsNow(PlayerEventBindings, key);
 }
 
 void Eluna::OnCreate(Player* pPlayer)
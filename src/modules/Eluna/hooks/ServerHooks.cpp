@@ -15,14 +15,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<ServerEvents>(EVENT);\
     if (!ServerEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EventKey<ServerEvents>(EVENT);\
     if (!ServerEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 bool Eluna::OnAddonMessage(Player* sender, uint32 type, std::string& msg, Player* receiver, Guild* guild, Group* group, Channel* channel)
 {
@@ -60,6 +64,8 @@ bool Eluna::OnAddonMessage(Player* sender, uint32 type, std::string& msg, Player
 
 void Eluna::OnTimedEvent(int funcRef, uint32 delay, uint32 calls, WorldObject* obj)
 {
+    auto stateGuard = LockState();
+
     ASSERT(!event_level);
 
     // Get function
@@ -299,7 +305,7 @@ void Eluna::OnDestroy(Map* map)
 {
     START_HOOK(MAP_EVENT_ON_DESTROY);
     HookPush(map);
-    CallAllFunctions(ServerEventBindings, key);
+    CallAllFunctionsNow(ServerEventBindings, key);
 }
 
 void Eluna::OnPlayerEnter(Map* map, Player* player)
@@ -315,7 +321,7 @@ void Eluna::OnPlayerLeave(Map* map, Player* player)
     START_HOOK(MAP_EVENT_ON_PLAYER_LEAVE);
     HookPush(map);
     HookPush(player);
-    CallAllFunctions(ServerEventBindings, key);
+    CallAllFunctionsNow(ServerEventBindings, key);
 }
 
 void Eluna::OnUpdate(Map* map, uint32 diff)
@@ -330,12 +336,12 @@ void Eluna::OnRemove(GameObject* gameobject)
 {
     START_HOOK(WORLD_EVENT_ON_DELETE_GAMEOBJECT);
     HookPush(gameobject);
-    CallAllFunctions(ServerEventBindings, key);
+    CallAllFunctionsNow(ServerEventBindings, key);
 }
 
 void Eluna::OnRemove(Creature* creature)
 {
     START_HOOK(WORLD_EVENT_ON_DELETE_CREATURE);
     HookPush(creature);
-    CallAllFunctions(ServerEventBindings, key);
+    CallAllFunctionsNow(ServerEventBindings, key);
 }
@@ -14,14 +14,18 @@
 using namespace Hooks;
 
 #define START_HOOK(EVENT, SPELL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<SpellEvents>(EVENT, SPELL->m_spellInfo->Id);\
     if (!SpellEventBindings->HasBindingsFor(key))\
-        return;
+        return;\
+    HookScope hookScope(this, bindingsGuard)
 
 #define START_HOOK_WITH_RETVAL(EVENT, SPELL, RETVAL) \
+    auto bindingsGuard = LockBindings();\
     auto key = EntryKey<SpellEvents>(EVENT, SPELL->m_spellInfo->Id);\
     if (!SpellEventBindings->HasBindingsFor(key))\
-        return RETVAL;
+        return RETVAL;\
+    HookScope hookScope(this, bindingsGuard)
 
 void Eluna::OnSpellCast(Spell* pSpell, bool skipCheck)
 {
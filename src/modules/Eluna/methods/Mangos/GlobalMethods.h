@@ -224,14 +224,15 @@ namespace LuaGlobalFunctions
      *
      * @param uint32 mapId : see [Map.dbc](https://github.com/cmangos/issues/wiki/Map.dbc)
      * @param uint32 instanceId = 0 : required if the map is an instance, otherwise don't pass anything
-     * @return [Map] map : the Map, or `nil` if it doesn't exist
+     * @return [Map] map : the Map, or `nil` if it doesn't exist or is not the map updating the calling code
      */
     int GetMapById(Eluna* E)
     {
         uint32 mapid = E->CHECKVAL<uint32>(1);
         uint32 instance = E->CHECKVAL<uint32>(2, 0);
 
-        E->Push(eMapMgr->FindMap(mapid, instance));
+        Map* map = eMapMgr->FindMap(mapid, instance);
+        E->Push(map && E->IsAccessibleMap(map) ? map : NULL);
         return 1;
     }
 
@@ -1474,7 +1475,7 @@ namespace LuaGlobalFunctions
 #endif
 
         Map* map = eMapMgr->FindMap(mapID, instanceID);
-        if (!map)
+        if (!map || !E->IsAccessibleMap(map))
         {
             E->Push();
             return 1;
@@ -1925,6 +1926,9 @@ namespace LuaGlobalFunctions
         }
 
         Player* receiverPlayer = eObjectAccessor()FindPlayer(MAKE_NEW_GUID(receiverGUIDLow, 0, HIGHGUID_PLAYER));
+        // a receiver on another map gets the mail from the database
+        if (receiverPlayer && !E->IsAccessibleMap(receiverPlayer->GetMap()))
+            receiverPlayer = NULL;
         draft.SendMailTo(MailReceiver(receiverPlayer, MAKE_NEW_GUID(receiverGUIDLow, 0, HIGHGUID_PLAYER)), sender);
         return addedItems;
     }
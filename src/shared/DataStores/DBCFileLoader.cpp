@@ -28,68 +28,41 @@
 
 #include "DBCFileLoader.h"
 
+#include <ace/Mem_Map.h>
+
+static const uint32 DBC_HEADER_SIZE = 5 * sizeof(uint32);   // magic, records, fields, record size, string size
+
 DBCFileLoader::DBCFileLoader()
 {
     data = NULL;
     fieldsOffset = NULL;
+    stringTable = NULL;
+    m_mappedFile = NULL;
 }
 
-bool DBCFileLoader::Load(const char* filename, const char* fmt)
+bool DBCFileLoader::ReadHeader(const unsigned char* header)
 {
-    uint32 header;
-    delete[] data;
-
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    uint32 magic;
+    memcpy(&magic, header, 4);
+    EndianConvert(magic);
+    if (magic != 0x43424457)                                //'WDBC'
     {
         return false;
     }
 
-    if (fread(&header, 4, 1, f) != 1)                       // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(header);
-    if (header != 0x43424457)                               //'WDBC'
-    {
-        fclose(f);
-        return false;
-    }
-
-    if (fread(&recordCount, 4, 1, f) != 1)                  // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&recordCount, header + 4, 4);                    // Number of records
     EndianConvert(recordCount);
-
-    if (fread(&fieldCount, 4, 1, f) != 1)                   // Number of fields
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&fieldCount, header + 8, 4);                     // Number of fields
     EndianConvert(fieldCount);
-
-    if (fread(&recordSize, 4, 1, f) != 1)                   // Size of a record
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&recordSize, header + 12, 4);                    // Size of a record
     EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                   // String size
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&stringSize, header + 16, 4);                    // String size
     EndianConvert(stringSize);
+    return true;
+}
 
+void DBCFileLoader::BuildFieldOffsets(const char* fmt)
+{
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; ++i)
@@ -104,6 +77,52 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += 4;
         }
     }
+}
+
+bool DBCFileLoader::Load(const char* filename, const char* fmt)
+{
+    Unload();
+
+    // Map the file copy-on-write: the pages come from the page cache and are shared with
+    // every other process mapping the same DBC, and the string block is used in place.
+    m_mappedFile = new ACE_Mem_Map();
+    if (m_mappedFile->map(filename, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_RDWR, ACE_MAP_PRIVATE) == 0)
+    {
+        m_mappedFile->close_handle();                       // the mapping stays valid without the descriptor
+
+        unsigned char* base = static_cast<unsigned char*>(m_mappedFile->addr());
+        size_t fileSize = m_mappedFile->size();
+        if (fileSize < DBC_HEADER_SIZE || !ReadHeader(base) ||
+            fileSize < DBC_HEADER_SIZE + size_t(recordSize) * recordCount + stringSize)
+        {
+            Unload();
+            return false;
+        }
+
+        data = base + DBC_HEADER_SIZE;
+        stringTable = data + recordSize * recordCount;
+        BuildFieldOffsets(fmt);
+        return true;
+    }
+
+    // mapping not available for this file, read it into memory instead
+    delete m_mappedFile;
+    m_mappedFile = NULL;
+
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+    {
+        return false;
+    }
+
+    unsigned char header[DBC_HEADER_SIZE];
+    if (fread(header, DBC_HEADER_SIZE, 1, f) != 1 || !ReadHeader(header))
+    {
+        fclose(f);
+        return false;
+    }
+
+    BuildFieldOffsets(fmt);
 
     data = new unsigned char[recordSize * recordCount + stringSize];
     stringTable = data + recordSize * recordCount;
@@ -118,10 +137,42 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
     return true;
 }
 
-DBCFileLoader::~DBCFileLoader()
+void DBCFileLoader::Unload()
 {
-    delete[] data;
+    if (m_mappedFile)
+    {
+        CloseMapping(m_mappedFile);
+        m_mappedFile = NULL;
+    }
+    else
+    {
+        delete[] data;
+    }
+
+    data = NULL;
+    stringTable = NULL;
+
     delete[] fieldsOffset;
+    fieldsOffset = NULL;
+}
+
+DBCFileLoader::~DBCFileLoader()
+{
+    Unload();
+}
+
+ACE_Mem_Map* DBCFileLoader::ReleaseMapping()
+{
+    ACE_Mem_Map* mapping = m_mappedFile;
+    m_mappedFile = NULL;
+    data = NULL;
+    stringTable = NULL;
+    return mapping;
+}
+
+void DBCFileLoader::CloseMapping(ACE_Mem_Map* mapping)
+{
+    delete mapping;                                         // unmaps the view
 }
 
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
@@ -284,8 +335,17 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
         return NULL;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // a mapped string block is private to us (copy-on-write), no need to copy it
+    char* stringPool;
+    if (m_mappedFile)
+    {
+        stringPool = reinterpret_cast<char*>(stringTable);
+    }
+    else
+    {
+        stringPool = new char[stringSize];
+        memcpy(stringPool, stringTable, stringSize);
+    }
 
     uint32 offset = 0;
 
@@ -29,6 +29,8 @@
 #include "Utilities/ByteConverter.h"
 #include <cassert>
 
+class ACE_Mem_Map;
+
 /**
  * @brief
  *
@@ -74,6 +76,11 @@ class DBCFileLoader
          * @return bool
          */
         bool Load(const char* filename, const char* fmt);
+        /**
+         * @brief Release the file contents and field offsets held by the loader
+         *
+         */
+        void Unload();
 
         /**
          * @brief
@@ -181,6 +188,28 @@ class DBCFileLoader
          * @return bool
          */
         bool IsLoaded() const {return (data != NULL);}
+        /**
+         * @brief Is the file contents backed by a memory mapping of the file
+         *
+         * @return bool
+         */
+        bool IsMapped() const { return m_mappedFile != NULL; }
+        /**
+         * @brief Hand the file mapping over to the caller, who must free it with CloseMapping.
+         *
+         * Strings produced by AutoProduceStrings from a mapped file point into the
+         * mapping, so it has to outlive the store using them. The loader itself
+         * can not be used for record access anymore afterwards.
+         *
+         * @return ACE_Mem_Map
+         */
+        ACE_Mem_Map* ReleaseMapping();
+        /**
+         * @brief Unmap a file mapping previously taken with ReleaseMapping
+         *
+         * @param mapping
+         */
+        static void CloseMapping(ACE_Mem_Map* mapping);
         /**
          * @brief
          *
@@ -191,7 +220,11 @@ class DBCFileLoader
          */
         char* AutoProduceData(const char* fmt, uint32& count, char**& indexTable);
         /**
-         * @brief
+         * @brief Fill the string fields of dataTable.
+         *
+         * For a mapped file the string block of the file is used in place and
+         * returned, the caller must then keep the mapping (see ReleaseMapping)
+         * instead of freeing the result. Otherwise a heap copy is returned.
          *
          * @param fmt
          * @param dataTable
@@ -207,6 +240,19 @@ class DBCFileLoader
          */
         static uint32 GetFormatRecordSize(const char* format, int32* index_pos = NULL);
     private:
+        /**
+         * @brief Read and validate the DBC header
+         *
+         * @param header the first 20 bytes of the file
+         * @return bool
+         */
+        bool ReadHeader(const unsigned char* header);
+        /**
+         * @brief
+         *
+         * @param fmt
+         */
+        void BuildFieldOffsets(const char* fmt);
 
         uint32 recordSize; /**< TODO */
         uint32 recordCount; /**< TODO */
@@ -215,5 +261,6 @@ class DBCFileLoader
         uint32* fieldsOffset; /**< TODO */
         unsigned char* data; /**< TODO */
         unsigned char* stringTable; /**< TODO */
+        ACE_Mem_Map* m_mappedFile; /**< copy-on-write mapping of the file, NULL when read into data */
 };
 #endif
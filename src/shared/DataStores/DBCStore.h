@@ -39,6 +39,11 @@ class DBCStorage
          *
          */
         typedef std::list<char*> StringPoolList;
+        /**
+         * @brief
+         *
+         */
+        typedef std::list<ACE_Mem_Map*> MappedFileList;
     public:
         /**
          * @brief
@@ -112,7 +117,7 @@ class DBCStorage
             m_dataTable = (T*)dbc.AutoProduceData(fmt, nCount, (char**&)indexTable);
 
             // load strings from dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)m_dataTable));
+            ProduceStrings(dbc);
 
             // error in dbc file at loading if NULL
             return indexTable != NULL;
@@ -158,7 +163,7 @@ class DBCStorage
             }
 
             // load strings from another locale dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)m_dataTable));
+            ProduceStrings(dbc);
 
             return true;
         }
@@ -190,6 +195,12 @@ class DBCStorage
                 delete[] m_stringPoolList.front();
                 m_stringPoolList.pop_front();
             }
+
+            while (!m_mappedFileList.empty())
+            {
+                DBCFileLoader::CloseMapping(m_mappedFileList.front());
+                m_mappedFileList.pop_front();
+            }
             nCount = 0;
         }
 
@@ -208,6 +219,26 @@ class DBCStorage
         void InsertEntry(T* entry, uint32 id) { assert(id < nCount && "Entry to be inserted must be in bounds!"); indexTable[id] = entry; }
 
     private:
+        /**
+         * @brief Fill the string fields from dbc and keep whatever backs them alive
+         *
+         * @param dbc
+         */
+        void ProduceStrings(DBCFileLoader& dbc)
+        {
+            char* stringPool = dbc.AutoProduceStrings(fmt, (char*)m_dataTable);
+
+            // strings of a mapped file point into the mapping itself
+            if (dbc.IsMapped())
+            {
+                m_mappedFileList.push_back(dbc.ReleaseMapping());
+            }
+            else
+            {
+                m_stringPoolList.push_back(stringPool);
+            }
+        }
+
         uint32 nCount; /**< TODO */
         uint32 fieldCount; /**< TODO */
         char const* fmt; /**< TODO */
@@ -216,6 +247,7 @@ class DBCStorage
         std::map<uint32, T const*> data;
         bool loaded;
         StringPoolList m_stringPoolList; /**< TODO */
+        MappedFileList m_mappedFileList; /**< DBC file mappings backing the strings */
 };
 
 #endif
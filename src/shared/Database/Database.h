@@ -621,6 +621,13 @@ class Database
          */
         void ProcessResultQueue();
 
+        /**
+         * @brief number of async statements not yet executed by the delay thread
+         *
+         * @return size_t
+         */
+        size_t GetDelayQueueSize() const { return m_threadBody ? m_threadBody->GetQueueSize() : 0; }
+
         /**
         * @brief Function to check that the database version matches expected core version
         *
@@ -79,6 +79,13 @@ class SqlDelayThread : public ACE_Based::Runnable
          */
         bool Delay(SqlOperation* sql) { m_sqlQueue.add(sql); return true; }
 
+        /**
+         * @brief Number of statements waiting to be executed
+         *
+         * @return size_t
+         */
+        size_t GetQueueSize() { return m_sqlQueue.size(); }
+
         /**
          * @brief Stop event
          *
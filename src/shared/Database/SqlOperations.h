@@ -31,6 +31,7 @@
 #include "LockedQueue/LockedQueue.h"
 #include <queue>
 #include "Utilities/Callback.h"
+#include "Utilities/ObjectPool.h"
 
 /// ---- BASE ---
 
@@ -45,6 +46,8 @@ class SqlStmtParameters;
  */
 class SqlOperation
 {
+        MANGOS_POOLED_OBJECT(SqlOperation)
+
     public:
         /**
          * @brief
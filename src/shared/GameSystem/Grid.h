@@ -29,6 +29,7 @@
 #include "Policies/ThreadingModel.h"
 #include "TypeContainer.h"
 #include "TypeContainerVisitor.h"
+#include "GridObjectIndex.h"
 
 // forward declaration
 template<class A, class T, class O> class GridLoader;
@@ -127,10 +128,18 @@ class Grid
             return m_activeGridObjects.size() + i_worldContainer.template count<ACTIVE_OBJECT>(nullptr);
         }
 
+        /**
+         * @brief positions of objects stored in both containers, filled by the owner of the grid
+         *
+         * @return GridObjectIndex
+         */
+        GridObjectIndex& GetObjectIndex() { return i_objectIndex; }
+
     private:
         GRID_CONTAINER  i_gridContainer;
         WORLD_CONTAINER i_worldContainer;
         std::set<void*> m_activeGridObjects;
+        GridObjectIndex i_objectIndex;
 };
 
 #endif
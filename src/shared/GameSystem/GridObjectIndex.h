@@ -0,0 +1,195 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_GRIDOBJECTINDEX_H
+#define MANGOS_GRIDOBJECTINDEX_H
+
+#include "Platform/Define.h"
+
+#include <vector>
+
+class GridObjectIndex;
+
+/**
+ * @brief Position of an object in the index of its cell, kept by the object itself.
+ *
+ * The index updates the slot when it moves the entry and clears the index pointer when it is destroyed.
+ */
+struct GridObjectIndexRef
+{
+    GridObjectIndexRef() : index(nullptr), slot(0) {}
+
+    GridObjectIndex* index;
+    uint32 slot;
+};
+
+/**
+ * @brief Flags of index entries
+ *
+ */
+enum GridObjectIndexFlags
+{
+    GRID_INDEX_FLAG_WORLD_CONTAINER = 0x01                  /**< stored in the world container of the cell (players, pets, player corpses) */
+};
+
+/**
+ * @brief Structure of arrays of the objects stored in one grid cell.
+ *
+ * Type mask, flags, position and bounding radius of every object are kept in separate arrays,
+ * so range and type checks of searchers run over contiguous memory and only objects passing
+ * them are dereferenced.
+ */
+class GridObjectIndex
+{
+    public:
+        GridObjectIndex() {}
+
+        /**
+         * @brief Detaches objects still indexed, they can outlive the grid (player corpses)
+         *
+         */
+        ~GridObjectIndex()
+        {
+            for (size_t i = 0; i < m_refs.size(); ++i)
+            {
+                m_refs[i]->index = nullptr;
+            }
+        }
+
+        /**
+         * @brief
+         *
+         * @param obj
+         * @param ref back reference stored in the object
+         * @param typeMask
+         * @param flags GridObjectIndexFlags
+         * @param x
+         * @param y
+         * @param bound bounding radius of the object
+         */
+        void Insert(void* obj, GridObjectIndexRef& ref, uint32 typeMask, uint32 flags, float x, float y, float bound)
+        {
+            ref.index = this;
+            ref.slot = uint32(m_objects.size());
+
+            m_typeMasks.push_back(typeMask);
+            m_flags.push_back(flags);
+            m_x.push_back(x);
+            m_y.push_back(y);
+            m_bounds.push_back(bound);
+            m_objects.push_back(obj);
+            m_refs.push_back(&ref);
+        }
+
+        /**
+         * @brief Removes the entry, last entry takes its slot
+         *
+         * @param ref
+         */
+        void Remove(GridObjectIndexRef& ref)
+        {
+            uint32 slot = ref.slot;
+            uint32 last = uint32(m_objects.size() - 1);
+            if (slot != last)
+            {
+                m_typeMasks[slot] = m_typeMasks[last];
+                m_flags[slot] = m_flags[last];
+                m_x[slot] = m_x[last];
+                m_y[slot] = m_y[last];
+                m_bounds[slot] = m_bounds[last];
+                m_objects[slot] = m_objects[last];
+                m_refs[slot] = m_refs[last];
+                m_refs[slot]->slot = slot;
+            }
+
+            m_typeMasks.pop_back();
+            m_flags.pop_back();
+            m_x.pop_back();
+            m_y.pop_back();
+            m_bounds.pop_back();
+            m_objects.pop_back();
+            m_refs.pop_back();
+
+            ref.index = nullptr;
+        }
+
+        /**
+         * @brief
+         *
+         * @param slot
+         * @param x
+         * @param y
+         * @param bound
+         */
+        void Relocate(uint32 slot, float x, float y, float bound)
+        {
+            m_x[slot] = x;
+            m_y[slot] = y;
+            m_bounds[slot] = bound;
+        }
+
+        /**
+         * @brief Calls func(obj) for entries matching typeMask and (entry flags & flagsMask) == flags
+         * which 2d distance to (x, y) minus own bounding radius is within radius.
+         *
+         * func must not add or remove objects of the cell.
+         */
+        template<class F>
+        void Visit(float x, float y, float radius, uint32 typeMask, uint32 flagsMask, uint32 flags, F& func) const
+        {
+            size_t count = m_objects.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                float dx = m_x[i] - x;
+                float dy = m_y[i] - y;
+                float dist = radius + m_bounds[i];
+                bool match = (m_typeMasks[i] & typeMask) && (m_flags[i] & flagsMask) == flags && dx * dx + dy * dy <= dist * dist;
+                if (match)
+                {
+                    func(m_objects[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief
+         *
+         * @return size_t
+         */
+        size_t size() const { return m_objects.size(); }
+
+    private:
+        GridObjectIndex(GridObjectIndex const&);
+        GridObjectIndex& operator=(GridObjectIndex const&);
+
+        std::vector<uint32> m_typeMasks;
+        std::vector<uint32> m_flags;
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+        std::vector<float> m_bounds;
+        std::vector<void*> m_objects;
+        std::vector<GridObjectIndexRef*> m_refs;
+};
+
+#endif
@@ -26,6 +26,7 @@
 #define MANGOS_H_EVENTPROCESSOR
 
 #include "Platform/Define.h"
+#include "ObjectPool.h"
 #include <map>
 
 /**
@@ -34,6 +35,8 @@
  */
 class BasicEvent
 {
+        MANGOS_POOLED_OBJECT(BasicEvent)
+
     public:
         /**
          * @brief Construct a new Basic Event object
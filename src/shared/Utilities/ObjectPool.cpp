@@ -0,0 +1,249 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "ObjectPool.h"
+
+#include <mutex>
+
+namespace
+{
+    // block sizes: 16 byte steps up to 256, 64 byte steps up to 1024, 256 byte steps up to 4096
+    const size_t MAX_POOLED_SIZE = 4096;
+    const uint32 NUM_SIZE_CLASSES = 16 + 12 + 12;
+
+    const size_t SLAB_SIZE = 64 * 1024;
+    const uint32 TRANSFER_BATCH = 32;                       // blocks moved between a thread cache and the depot at once
+    const uint32 MAX_CACHED_BLOCKS = 2 * TRANSFER_BATCH;    // per size class and thread
+
+    inline uint32 GetSizeClass(size_t size)
+    {
+        if (size <= 256)
+        {
+            return size ? uint32((size - 1) / 16) : 0;
+        }
+        if (size <= 1024)
+        {
+            return 16 + uint32((size - 257) / 64);
+        }
+        return 28 + uint32((size - 1025) / 256);
+    }
+
+    inline size_t GetBlockSize(uint32 sizeClass)
+    {
+        if (sizeClass < 16)
+        {
+            return (sizeClass + 1) * 16;
+        }
+        if (sizeClass < 28)
+        {
+            return 256 + (sizeClass - 15) * 64;
+        }
+        return 1024 + (sizeClass - 27) * 256;
+    }
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    /// Free blocks shared by all threads, filled from new slabs and by overfull thread caches
+    class SlabDepot
+    {
+        public:
+            SlabDepot() : m_slabs(0)
+            {
+                for (uint32 i = 0; i < NUM_SIZE_CLASSES; ++i)
+                {
+                    m_free[i] = nullptr;
+                }
+            }
+
+            // takes up to TRANSFER_BATCH blocks, returns their number
+            uint32 Take(uint32 sizeClass, FreeBlock*& list)
+            {
+                std::lock_guard<std::mutex> guard(m_locks[sizeClass]);
+
+                if (!m_free[sizeClass])
+                {
+                    AddSlab(sizeClass);
+                }
+
+                uint32 count = 0;
+                while (m_free[sizeClass] && count < TRANSFER_BATCH)
+                {
+                    FreeBlock* block = m_free[sizeClass];
+                    m_free[sizeClass] = block->next;
+                    block->next = list;
+                    list = block;
+                    ++count;
+                }
+                return count;
+            }
+
+            // gives back up to TRANSFER_BATCH blocks from the list head, returns their number
+            uint32 Give(uint32 sizeClass, FreeBlock*& list)
+            {
+                std::lock_guard<std::mutex> guard(m_locks[sizeClass]);
+
+                uint32 count = 0;
+                while (list && count < TRANSFER_BATCH)
+                {
+                    FreeBlock* block = list;
+                    list = block->next;
+                    block->next = m_free[sizeClass];
+                    m_free[sizeClass] = block;
+                    ++count;
+                }
+                return count;
+            }
+
+            uint64 GetSlabCount() const { return m_slabs.load(std::memory_order_relaxed); }
+
+        private:
+            void AddSlab(uint32 sizeClass)
+            {
+                size_t blockSize = GetBlockSize(sizeClass);
+                char* slab = static_cast<char*>(::operator new(SLAB_SIZE));
+                m_slabs.fetch_add(1, std::memory_order_relaxed);
+
+                for (size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize)
+                {
+                    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + offset);
+                    block->next = m_free[sizeClass];
+                    m_free[sizeClass] = block;
+                }
+            }
+
+            std::mutex m_locks[NUM_SIZE_CLASSES];
+            FreeBlock* m_free[NUM_SIZE_CLASSES];
+            std::atomic<uint64> m_slabs;
+    };
+
+    // never destroyed, pooled objects may be deleted during static destruction
+    SlabDepot& GetDepot()
+    {
+        static SlabDepot* depot = new SlabDepot();
+        return *depot;
+    }
+
+    /// Per thread free blocks. Left trivially destructible on purpose: pooled objects may still be
+    /// deleted during static destruction, the few cached blocks of an ending thread are not reused.
+    struct ThreadCache
+    {
+        FreeBlock* free[NUM_SIZE_CLASSES];
+        uint32 count[NUM_SIZE_CLASSES];
+
+        ThreadCache()
+        {
+            for (uint32 i = 0; i < NUM_SIZE_CLASSES; ++i)
+            {
+                free[i] = nullptr;
+                count[i] = 0;
+            }
+        }
+    };
+
+    thread_local ThreadCache t_cache;
+
+    std::atomic<MaNGOS::ObjectPool*> s_firstPool(nullptr);
+}
+
+namespace MaNGOS
+{
+    ObjectPool::ObjectPool(char const* name) : m_name(name), m_next(nullptr),
+        m_allocations(0), m_deallocations(0), m_liveBytes(0), m_oversized(0)
+    {
+        // pools are created on first use, possibly by several threads
+        m_next = s_firstPool.load();
+        while (!s_firstPool.compare_exchange_weak(m_next, this))
+        {
+        }
+    }
+
+    ObjectPool const* ObjectPool::GetFirst()
+    {
+        return s_firstPool.load();
+    }
+
+    void ObjectPool::GetSlabStatistic(uint64& slabs, uint64& bytes)
+    {
+        slabs = GetDepot().GetSlabCount();
+        bytes = slabs * SLAB_SIZE;
+    }
+
+    void* ObjectPool::Allocate(size_t size)
+    {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        if (size > MAX_POOLED_SIZE)
+        {
+            m_oversized.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+
+        uint32 sizeClass = GetSizeClass(size);
+        m_liveBytes.fetch_add(GetBlockSize(sizeClass), std::memory_order_relaxed);
+
+        ThreadCache& cache = t_cache;
+        if (!cache.free[sizeClass])
+        {
+            cache.count[sizeClass] += GetDepot().Take(sizeClass, cache.free[sizeClass]);
+        }
+
+        FreeBlock* block = cache.free[sizeClass];
+        cache.free[sizeClass] = block->next;
+        --cache.count[sizeClass];
+        return block;
+    }
+
+    void ObjectPool::Deallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        m_deallocations.fetch_add(1, std::memory_order_relaxed);
+
+        if (size > MAX_POOLED_SIZE)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        uint32 sizeClass = GetSizeClass(size);
+        m_liveBytes.fetch_sub(GetBlockSize(sizeClass), std::memory_order_relaxed);
+
+        ThreadCache& cache = t_cache;
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = cache.free[sizeClass];
+        cache.free[sizeClass] = block;
+
+        // threads that mostly delete (e.g. packets created by the network threads) pass blocks on
+        if (++cache.count[sizeClass] > MAX_CACHED_BLOCKS)
+        {
+            cache.count[sizeClass] -= GetDepot().Give(sizeClass, cache.free[sizeClass]);
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_H_OBJECTPOOL
+#define MANGOS_H_OBJECTPOOL
+
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace MaNGOS
+{
+    /**
+     * @brief Allocation statistics of one pooled class hierarchy.
+     *
+     * Memory comes from slabs split in fixed size blocks, one free list per block size.
+     * Every thread keeps a small cache of free blocks and exchanges batches with a shared,
+     * locked depot, so objects may be deleted by another thread than the one that created them.
+     * Slabs are never given back to the system. Objects bigger than the largest block size
+     * use the global operator new.
+     */
+    class ObjectPool
+    {
+        public:
+            /**
+             * @brief Registers a pool, pools must never be destroyed.
+             * @param name Name shown in the statistics.
+             */
+            explicit ObjectPool(char const* name);
+
+            /**
+             * @brief Allocates a block for an object of the given size.
+             * @param size sizeof of the allocated type.
+             * @return void* Never NULL, throws std::bad_alloc.
+             */
+            void* Allocate(size_t size);
+
+            /**
+             * @brief Gives back a block.
+             * @param ptr Block returned by Allocate.
+             * @param size The size passed to Allocate for this block.
+             */
+            void Deallocate(void* ptr, size_t size);
+
+            char const* GetName() const { return m_name; }
+            uint64 GetAllocations() const { return m_allocations.load(std::memory_order_relaxed); }
+            uint64 GetDeallocations() const { return m_deallocations.load(std::memory_order_relaxed); }
+            uint64 GetLiveBytes() const { return m_liveBytes.load(std::memory_order_relaxed); }
+            uint64 GetOversized() const { return m_oversized.load(std::memory_order_relaxed); }
+
+            ObjectPool const* GetNext() const { return m_next; }
+
+            /**
+             * @brief First of all registered pools.
+             * @return ObjectPool const*
+             */
+            static ObjectPool const* GetFirst();
+
+            /**
+             * @brief Memory taken from the system for the slabs of all pools.
+             * @param slabs Number of slabs.
+             * @param bytes Size of these slabs.
+             */
+            static void GetSlabStatistic(uint64& slabs, uint64& bytes);
+
+        private:
+            ObjectPool(ObjectPool const&);
+            ObjectPool& operator=(ObjectPool const&);
+
+            char const* m_name;
+            ObjectPool* m_next;
+            std::atomic<uint64> m_allocations;
+            std::atomic<uint64> m_deallocations;
+            std::atomic<uint64> m_liveBytes;
+            std::atomic<uint64> m_oversized;
+    };
+}
+
+/**
+ * Routes new and delete of CLASS and its subclasses through a MaNGOS::ObjectPool named after CLASS.
+ * CLASS must have a virtual destructor if subclasses are deleted through it. The nothrow form
+ * (used by ACE_NEW) is only meant for CLASS itself.
+ */
+#define MANGOS_POOLED_OBJECT(CLASS)                                                                     \
+    public:                                                                                             \
+        static MaNGOS::ObjectPool& GetObjectPool()                                                      \
+        {                                                                                               \
+            static MaNGOS::ObjectPool* pool = new MaNGOS::ObjectPool(#CLASS);                           \
+            return *pool;                                                                               \
+        }                                                                                               \
+        static void* operator new(size_t size) { return GetObjectPool().Allocate(size); }              \
+        static void* operator new(size_t size, std::nothrow_t const&) throw()                          \
+        {                                                                                               \
+            try { return GetObjectPool().Allocate(size); }                                              \
+            catch (std::bad_alloc&) { return NULL; }                                                    \
+        }                                                                                               \
+        static void operator delete(void* ptr, size_t size) { GetObjectPool().Deallocate(ptr, size); } \
+        static void operator delete(void* ptr, std::nothrow_t const&) throw()                          \
+        {                                                                                               \
+            GetObjectPool().Deallocate(ptr, sizeof(CLASS));                                             \
+        }
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+
+#include "TickArena.h"
+#include "Errors.h"
+
+#include <cstdint>
+
+namespace
+{
+    const size_t MAX_ALIGN = 16;
+
+    thread_local MaNGOS::TickArena* t_currentArena = nullptr;
+}
+
+namespace MaNGOS
+{
+    TickArena::Scope::Scope(TickArena& arena) : m_arena(arena), m_previous(t_currentArena)
+    {
+        ++m_arena.m_depth;
+        t_currentArena = &m_arena;
+    }
+
+    TickArena::Scope::~Scope()
+    {
+        t_currentArena = m_previous;
+        if (--m_arena.m_depth == 0)
+        {
+            m_arena.Reset();
+        }
+    }
+
+    TickArena::TickArena(size_t chunkSize) : m_chunkSize(chunkSize), m_usedChunks(nullptr), m_freeChunks(nullptr),
+        m_bigChunks(nullptr), m_pos(nullptr), m_end(nullptr), m_used(0), m_peak(0), m_depth(0)
+    {
+    }
+
+    TickArena::~TickArena()
+    {
+        MANGOS_ASSERT(!m_depth);
+
+        FreeChunks(m_usedChunks);
+        FreeChunks(m_freeChunks);
+        FreeChunks(m_bigChunks);
+    }
+
+    TickArena* TickArena::GetCurrent()
+    {
+        return t_currentArena;
+    }
+
+    TickArena::Chunk* TickArena::NewChunk(size_t size)
+    {
+        Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+        chunk->next = nullptr;
+        chunk->size = size;
+        return chunk;
+    }
+
+    void TickArena::FreeChunks(Chunk* list)
+    {
+        while (list)
+        {
+            Chunk* next = list->next;
+            ::operator delete(list);
+            list = next;
+        }
+    }
+
+    void* TickArena::Allocate(size_t size, size_t align)
+    {
+        MANGOS_ASSERT(align && align <= MAX_ALIGN && !(align & (align - 1)));
+
+        size = size ? size : 1;
+        m_used += size;
+        if (m_used > m_peak)
+        {
+            m_peak = m_used;
+        }
+
+        char* pos = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(m_pos) + align - 1) & ~uintptr_t(align - 1));
+        if (m_pos && pos + size <= m_end)
+        {
+            m_pos = pos + size;
+            return pos;
+        }
+
+        // too big for a chunk, chunk data is aligned to MAX_ALIGN
+        if (size > m_chunkSize / 4)
+        {
+            Chunk* chunk = NewChunk(size);
+            chunk->next = m_bigChunks;
+            m_bigChunks = chunk;
+            return GetData(chunk);
+        }
+
+        Chunk* chunk = m_freeChunks;
+        if (chunk)
+        {
+            m_freeChunks = chunk->next;
+        }
+        else
+        {
+            chunk = NewChunk(m_chunkSize);
+        }
+
+        chunk->next = m_usedChunks;
+        m_usedChunks = chunk;
+
+        m_pos = GetData(chunk) + size;
+        m_end = GetData(chunk) + chunk->size;
+        return GetData(chunk);
+    }
+
+    void TickArena::Reset()
+    {
+        while (m_usedChunks)
+        {
+            Chunk* chunk = m_usedChunks;
+            m_usedChunks = chunk->next;
+            chunk->next = m_freeChunks;
+            m_freeChunks = chunk;
+        }
+
+        FreeChunks(m_bigChunks);
+        m_bigChunks = nullptr;
+
+        m_pos = nullptr;
+        m_end = nullptr;
+        m_used = 0;
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+
+#ifndef MANGOS_H_TICKARENA
+#define MANGOS_H_TICKARENA
+
+#include "Platform/Define.h"
+
+#include <cstddef>
+#include <new>
+
+namespace MaNGOS
+{
+    /**
+     * @brief Bump allocator for memory that lives no longer than one update tick.
+     *
+     * Memory is handed out from chunks by moving a pointer and is only given back by Reset,
+     * which keeps the chunks for the next tick. A thread makes an arena current with a
+     * TickArena::Scope, containers using TickAllocator then take their memory from it.
+     * An arena must only be used by one thread at a time.
+     */
+    class TickArena
+    {
+        public:
+            /**
+             * @brief RAII guard making an arena current for the calling thread.
+             *
+             * The arena is reset when the outermost scope of it ends, everything allocated
+             * from it inside the scope must be destroyed by then.
+             */
+            class Scope
+            {
+                public:
+                    explicit Scope(TickArena& arena);
+                    ~Scope();
+
+                private:
+                    Scope(Scope const&);
+                    Scope& operator=(Scope const&);
+
+                    TickArena& m_arena;
+                    TickArena* m_previous;
+            };
+
+            /**
+             * @param chunkSize Size of the chunks taken from the system.
+             */
+            explicit TickArena(size_t chunkSize = 64 * 1024);
+            ~TickArena();
+
+            /**
+             * @brief Allocates memory valid until the next Reset.
+             * @param size Requested size.
+             * @param align Requested alignment, a power of two up to 16.
+             * @return void* Never NULL, throws std::bad_alloc.
+             */
+            void* Allocate(size_t size, size_t align);
+
+            /**
+             * @brief Invalidates all memory handed out, big allocations are given back to the system.
+             */
+            void Reset();
+
+            size_t GetUsed() const { return m_used; }
+            size_t GetPeak() const { return m_peak; }
+
+            /**
+             * @brief Arena of the innermost active Scope of the calling thread.
+             * @return TickArena* NULL outside of any scope.
+             */
+            static TickArena* GetCurrent();
+
+        private:
+            TickArena(TickArena const&);
+            TickArena& operator=(TickArena const&);
+
+            struct Chunk
+            {
+                Chunk* next;
+                size_t size;
+            };
+
+            static Chunk* NewChunk(size_t size);
+            static void FreeChunks(Chunk* list);
+            static char* GetData(Chunk* chunk) { return reinterpret_cast<char*>(chunk + 1); }
+
+            size_t m_chunkSize;
+            Chunk* m_usedChunks;                            ///< chunks handed out this tick, the first one is the current
+            Chunk* m_freeChunks;                            ///< chunks kept from previous ticks
+            Chunk* m_bigChunks;                             ///< single allocations bigger than a chunk
+            char* m_pos;
+            char* m_end;
+            size_t m_used;
+            size_t m_peak;
+            uint32 m_depth;                                 ///< number of active scopes of this arena
+    };
+
+    /**
+     * @brief STL allocator taking memory from the tick arena current at its construction.
+     *
+     * Containers created outside of a TickArena::Scope use the heap. Containers created inside
+     * must not outlive the scope, copies of them use the arena current at copy time.
+     */
+    template<class T>
+    class TickAllocator
+    {
+        public:
+            typedef T value_type;
+
+            TickAllocator() : m_arena(TickArena::GetCurrent()) {}
+            template<class U> TickAllocator(TickAllocator<U> const& other) : m_arena(other.GetArena()) {}
+
+            T* allocate(size_t n)
+            {
+                if (m_arena)
+                {
+                    return static_cast<T*>(m_arena->Allocate(n * sizeof(T), alignof(T)));
+                }
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+
+            void deallocate(T* ptr, size_t /*n*/)
+            {
+                // arena memory is given back at once by TickArena::Reset
+                if (!m_arena)
+                {
+                    ::operator delete(ptr);
+                }
+            }
+
+            TickAllocator select_on_container_copy_construction() const { return TickAllocator(); }
+
+            TickArena* GetArena() const { return m_arena; }
+
+        private:
+            TickArena* m_arena;
+    };
+
+    template<class T, class U>
+    inline bool operator==(TickAllocator<T> const& a, TickAllocator<U> const& b) { return a.GetArena() == b.GetArena(); }
+
+    template<class T, class U>
+    inline bool operator!=(TickAllocator<T> const& a, TickAllocator<U> const& b) { return a.GetArena() != b.GetArena(); }
+}
+
+#endif
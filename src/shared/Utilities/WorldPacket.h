@@ -27,6 +27,7 @@
 
 #include "Common.h"
 #include "ByteBuffer.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 
 // Note: m_opcode and size stored in platfom dependent format
@@ -37,6 +38,8 @@
  */
 class WorldPacket : public ByteBuffer
 {
+        MANGOS_POOLED_OBJECT(WorldPacket)
+
     public:
         /**
          * @brief just container for later use